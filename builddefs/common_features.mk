@@ -135,6 +135,10 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
+        ifeq ($(strip $(PLATFORM)), CHIBIOS)
+            SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/pointing_device_sampling.c
+        endif
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -143,25 +147,33 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         OPT_DEFS += -DPOINTING_DEVICE_DRIVER_NAME=$(strip $(POINTING_DEVICE_DRIVER))
         ifeq ($(strip $(POINTING_DEVICE_DRIVER)), adns9800)
             SPI_DRIVER_REQUIRED = yes
+            SRC += drivers/sensors/sensor_transfer.c
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), analog_joystick)
             ANALOG_DRIVER_REQUIRED = yes
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), azoteq_iqs5xx)
             I2C_DRIVER_REQUIRED = yes
+            POINTING_DEVICE_TOUCH_ENABLE = yes
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), cirque_pinnacle_i2c)
             I2C_DRIVER_REQUIRED = yes
+            POINTING_DEVICE_TOUCH_ENABLE = yes
             SRC += drivers/sensors/cirque_pinnacle.c
             SRC += drivers/sensors/cirque_pinnacle_gestures.c
-            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), cirque_pinnacle_spi)
             SPI_DRIVER_REQUIRED = yes
+            POINTING_DEVICE_TOUCH_ENABLE = yes
             SRC += drivers/sensors/cirque_pinnacle.c
             SRC += drivers/sensors/cirque_pinnacle_gestures.c
-            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), pimoroni_trackball)
             I2C_DRIVER_REQUIRED = yes
         else ifneq ($(filter $(strip $(POINTING_DEVICE_DRIVER)),pmw3360 pmw3389),)
             SPI_DRIVER_REQUIRED = yes
             SRC += drivers/sensors/pmw33xx_common.c
+            SRC += drivers/sensors/sensor_transfer.c
+        endif
+        ifeq ($(strip $(POINTING_DEVICE_TOUCH_ENABLE)), yes)
+            OPT_DEFS += -DPOINTING_DEVICE_TOUCH_ENABLE
+            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_touch.c
+            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         endif
     endif
 endif
@@ -95,6 +95,24 @@ flash_status_t flash_erase_block(uint32_t addr);
  */
 flash_status_t flash_erase_sector(uint32_t addr);
 
+/**
+ * @brief Initiates a sector erase operation.
+ *
+ * This function does not wait for the flash to become ready. Subsequent flash operations will wait for the erase to complete, or flash_is_busy() may be used to poll for completion.
+ *
+ * @param addr The address of the sector to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_sector(uint32_t addr);
+
+/**
+ * @brief Waits for the sector erase operation to complete.
+ *
+ * @return FLASH_STATUS_SUCCESS if the sector erase operation completed successfully, FLASH_STATUS_TIMEOUT if the flash was still busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_wait_erase_sector(void);
+
 /**
  * @brief Reads a range of flash memory.
  *
@@ -209,7 +209,7 @@ flash_status_t flash_erase_chip(void) {
     return flash_wait_erase_chip();
 }
 
-flash_status_t flash_erase_sector(uint32_t addr) {
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
@@ -239,16 +239,29 @@ flash_status_t flash_erase_sector(uint32_t addr) {
         return response;
     }
 
+    return response;
+}
+
+flash_status_t flash_wait_erase_sector(void) {
     /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    flash_status_t response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase sector]\n");
         return response;
     }
-
     return response;
 }
 
+flash_status_t flash_erase_sector(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_sector(addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to begin erase sector! [spi flash erase sector]\n");
+        return response;
+    }
+
+    return flash_wait_erase_sector();
+}
+
 flash_status_t flash_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
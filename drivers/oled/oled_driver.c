@@ -189,6 +189,7 @@ uint16_t oled_update_timeout;
 
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    oled_send_wait();
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -211,6 +212,7 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 
 __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 #if defined(__AVR__)
+    oled_send_wait();
 #    if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -236,6 +238,7 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 }
 
 __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
+    oled_send_wait();
 #if defined(OLED_TRANSPORT_SPI)
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
@@ -255,6 +258,43 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #endif
 }
 
+#if defined(OLED_TRANSPORT_SPI)
+static bool oled_transfer_in_progress = false;
+#endif
+
+// Starts sending data, returning before the transfer completes where the transport allows. The data must remain
+// unmodified until oled_send_wait() is called -- any other transfer waits for it first.
+__attribute__((weak)) bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+#if defined(OLED_TRANSPORT_SPI)
+    oled_send_wait();
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data Mode
+    gpio_write_pin_high(OLED_DC_PIN);
+    // Start sending the data, the bus is released once it completes
+    if (spi_transmit_async(data, size) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+    oled_transfer_in_progress = true;
+    return true;
+#else
+    // I2C transfers can't be left running in the background, so the data is sent immediately
+    return oled_send_data(data, size);
+#endif
+}
+
+__attribute__((weak)) void oled_send_wait(void) {
+#if defined(OLED_TRANSPORT_SPI)
+    if (oled_transfer_in_progress) {
+        oled_transfer_in_progress = false;
+        spi_transmit_wait();
+        spi_stop();
+    }
+#endif
+}
+
 __attribute__((weak)) void oled_driver_init(void) {
 #if defined(OLED_TRANSPORT_SPI)
     spi_init();
@@ -433,19 +473,97 @@ static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
 #endif
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
-}
+// Each nibble's bits spread out to the lowest bit of separate bytes, so 8x8 blocks can be transposed a nibble at a time
+static const uint32_t PROGMEM nibble_spread[16] = {
+    0x00000000, 0x00000001, 0x00000100, 0x00000101, 0x00010000, 0x00010001, 0x00010100, 0x00010101, 0x01000000, 0x01000001, 0x01000100, 0x01000101, 0x01010000, 0x01010001, 0x01010100, 0x01010101,
+};
 
+// Rotates an 8x8 block -- bit i of source byte j becomes bit (7 - j) of destination byte i
 static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+    uint32_t low  = 0;
+    uint32_t high = 0;
+    for (uint8_t j = 0; j < 8; ++j) {
+        low |= pgm_read_dword(&nibble_spread[src[j] & 0x0F]) << (7 - j);
+        high |= pgm_read_dword(&nibble_spread[src[j] >> 4]) << (7 - j);
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        dest[i]     = (uint8_t)(low >> (i * 8));
+        dest[i + 4] = (uint8_t)(high >> (i * 8));
+    }
+}
+
+// Sends a single block to the display, rotating it into the supplied temporary buffer first where required. The data may
+// still be being sent when this returns, see oled_send_data_async().
+static bool oled_render_block(uint8_t block, uint8_t *temp_buffer) {
+    // Set column & page position
+#if OLED_IC_HAS_HORIZONTAL_MODE
+    static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+    static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        calc_bounds(block, &display_start[1]); // Offset from I2C_CMD byte at the start
+    } else {
+        calc_bounds_90(block, &display_start[1]); // Offset from I2C_CMD byte at the start
+    }
+
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+#if OLED_RENDER_BUFFER_COUNT < 2
+        // The only buffer may still be being sent
+        oled_send_wait();
+#endif
+        // Rotate the render chunks
+        const static uint8_t source_map[] = OLED_SOURCE_MAP;
+        const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+        memset(temp_buffer, 0, OLED_BLOCK_SIZE);
+        for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+            rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &temp_buffer[target_map[i]]);
         }
     }
+
+    // Send column & page position
+    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        print("oled_render offset command failed\n");
+        return false;
+    }
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // Send render data chunk as is
+        if (!oled_send_data_async(&oled_buffer[OLED_BLOCK_SIZE * block], OLED_BLOCK_SIZE)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+    } else {
+#if OLED_IC_HAS_HORIZONTAL_MODE
+        // Send render data chunk after rotating
+        if (!oled_send_data_async(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+            print("oled_render90 data failed\n");
+            return false;
+        }
+#else
+        // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
+        const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+        const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
+        for (uint8_t i = 0; i < num_pages; ++i) {
+            // Send column & page position for all pages except the first one
+            if (i > 0) {
+                display_start[1]++;
+                if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                    print("oled_render offset command failed\n");
+                    return false;
+                }
+            }
+            // Send data for the page
+            if (!oled_send_data_async(&temp_buffer[columns_in_block * i], columns_in_block)) {
+                print("oled_render90 data failed\n");
+                return false;
+            }
+        }
+#endif
+    }
+
+    return true;
 }
 
 void oled_render_dirty(bool all) {
@@ -458,6 +576,10 @@ void oled_render_dirty(bool all) {
     // Turn on display if it is off
     oled_on();
 
+    // Rotated blocks are prepared in one buffer while the previous block is sent from the other
+    static uint8_t temp_buffers[OLED_RENDER_BUFFER_COUNT][OLED_BLOCK_SIZE];
+    uint8_t        temp_buffer_index = 0;
+
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
     while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
@@ -466,72 +588,20 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
-        // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
+        if (!oled_render_block(update_start, temp_buffers[temp_buffer_index])) {
+            break;
         }
-
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
-            return;
-        }
-
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
-                return;
-            }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
-
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
-                return;
-            }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
-            }
-#endif
+        if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            temp_buffer_index = (temp_buffer_index + 1) % OLED_RENDER_BUFFER_COUNT;
         }
 
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
+
+    // The buffers may be modified as soon as rendering returns, so the last block has to have been sent -- this includes
+    // when a block failed part way through
+    oled_send_wait();
 }
 
 void oled_set_cursor(uint8_t col, uint8_t line) {
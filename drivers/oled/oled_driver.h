@@ -321,6 +321,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// Number of buffers used to render rotated blocks, with two the next block is rotated while the previous one is sent.
+// Only SPI sends blocks asynchronously, so I2C gains nothing from a second buffer.
+#if !defined(OLED_RENDER_BUFFER_COUNT)
+#    if defined(OLED_TRANSPORT_SPI)
+#        define OLED_RENDER_BUFFER_COUNT 2
+#    else
+#        define OLED_RENDER_BUFFER_COUNT 1
+#    endif
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
@@ -342,6 +352,8 @@ bool oled_init(oled_rotation_t rotation);
 bool oled_send_cmd(const uint8_t *data, uint16_t size);
 bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
+bool oled_send_data_async(const uint8_t *data, uint16_t size);
+void oled_send_wait(void);
 void oled_driver_init(void);
 
 // Called at the start of oled_init, weak function overridable by the user
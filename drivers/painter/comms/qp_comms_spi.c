@@ -30,13 +30,15 @@ bool qp_comms_spi_start(painter_device_t device) {
     return spi_start(comms_config->chip_select_pin, comms_config->lsb_first, comms_config->mode, comms_config->divisor);
 }
 
+// Maximum number of bytes sent in a single SPI transfer
+#    define QP_COMMS_SPI_MAX_MSG_LENGTH 1024
+
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
-    const uint32_t max_msg_length  = 1024;
 
     while (bytes_remaining > 0) {
-        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
+        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, QP_COMMS_SPI_MAX_MSG_LENGTH);
         spi_transmit(p, bytes_this_loop);
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
@@ -45,6 +47,18 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+uint32_t qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    // Larger payloads would need the transfers chained, so they're sent synchronously instead
+    if (byte_count > QP_COMMS_SPI_MAX_MSG_LENGTH || spi_transmit_async((const uint8_t *)data, byte_count) != SPI_STATUS_SUCCESS) {
+        return qp_comms_spi_send_data(device, data, byte_count);
+    }
+    return byte_count;
+}
+
+void qp_comms_spi_wait(painter_device_t device) {
+    spi_transmit_wait();
+}
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +71,9 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+
+    .comms_send_async = qp_comms_spi_send_data_async,
+    .comms_wait       = qp_comms_spi_wait,
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +114,13 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+uint32_t qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -135,6 +159,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+            .comms_wait       = qp_comms_spi_wait,
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
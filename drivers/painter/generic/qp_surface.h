@@ -21,6 +21,22 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_TILE_SIZE
+/**
+ * @def This controls the width and height (in pixels) of the tiles used to track which areas of a surface have been
+ *      drawn to. Only dirty tiles are transferred when drawing a surface to a display. Must be a power of two.
+ */
+#    define SURFACE_DIRTY_TILE_SIZE 16
+#endif
+
+#ifndef SURFACE_DIRTY_TILE_ROWS
+/**
+ * @def This controls the maximum number of rows of dirty tiles tracked for each surface, each requiring 4 bytes of RAM.
+ *      Surfaces are at most 32 tiles wide -- larger surfaces automatically use larger tiles.
+ */
+#    define SURFACE_DIRTY_TILE_ROWS 16
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +80,63 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Sets the color treated as transparent when the surface is used as a layer with qp_surface_compose().
+ *
+ * @param surface[in] the surface to configure
+ * @param hue[in] the hue of the transparent color
+ * @param sat[in] the saturation of the transparent color
+ * @param val[in] the value of the transparent color
+ * @return whether the color could be converted to the surface's native pixel format
+ */
+bool qp_surface_set_transparent_color(painter_device_t surface, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Helper method to draw several layered surfaces to the target device, such as a background, widgets and overlays.
+ *
+ * Each pixel is taken from the top-most layer which isn't transparent at that location, the bottom layer is always
+ * opaque. Only the areas which are dirty in at least one of the layers are drawn. After successful completion, the dirty
+ * areas of all the layers are reset.
+ *
+ * @param layers[in] the surfaces to composite, bottom-most first -- all must have the same size and pixel format
+ * @param num_layers[in] the number of layers
+ * @param target[in] the target device to copy into
+ * @param x[in] the x-location of the original position of the layers
+ * @param y[in] the y-location of the original position of the layers
+ * @param entire_surface[in] whether the entire area should be drawn, instead of just the dirty regions
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_compose(painter_device_t *layers, uint8_t num_layers, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
+
+/**
+ * Draws an anti-aliased circle onto an RGB565 surface, blending its edges with the existing contents of the surface.
+ *
+ * @param surface[in] the RGB565 surface to draw onto
+ * @param x[in] the x-location of the center of the circle
+ * @param y[in] the y-location of the center of the circle
+ * @param radius[in] the radius of the circle
+ * @param hue[in] the hue of the circle
+ * @param sat[in] the saturation of the circle
+ * @param val[in] the value of the circle
+ * @param filled[in] whether the circle should be filled, or only a one pixel wide outline drawn
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_circle_aa(painter_device_t surface, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Draws an anti-aliased ellipse onto an RGB565 surface, blending its edges with the existing contents of the surface.
+ *
+ * @param surface[in] the RGB565 surface to draw onto
+ * @param x[in] the x-location of the center of the ellipse
+ * @param y[in] the y-location of the center of the ellipse
+ * @param sizex[in] the horizontal radius of the ellipse
+ * @param sizey[in] the vertical radius of the ellipse
+ * @param hue[in] the hue of the ellipse
+ * @param sat[in] the saturation of the ellipse
+ * @param val[in] the value of the ellipse
+ * @param filled[in] whether the ellipse should be filled, or only a one pixel wide outline drawn
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_ellipse_aa(painter_device_t surface, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "color.h"
+#include "qp_comms.h"
 #include "qp_draw.h"
 #include "qp_surface_internal.h"
 
+STATIC_ASSERT((SURFACE_DIRTY_TILE_SIZE & (SURFACE_DIRTY_TILE_SIZE - 1)) == 0, "SURFACE_DIRTY_TILE_SIZE must be a power of two");
+STATIC_ASSERT(SURFACE_DIRTY_TILE_ROWS > 0, "SURFACE_DIRTY_TILE_ROWS must be at least 1");
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Driver storage
 
@@ -47,6 +51,74 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Maintain dirty tiles
+    dirty->tiles[y >> dirty->tile_shift] |= (1UL << (x >> dirty->tile_shift));
+}
+
+void qp_surface_setup_dirty_tiles(surface_dirty_data_t *dirty, uint16_t panel_width, uint16_t panel_height) {
+    // Start with the configured tile size, growing the tiles until the whole surface fits within the dirty map
+    uint8_t shift = __builtin_ctz(SURFACE_DIRTY_TILE_SIZE);
+    while (((panel_width - 1) >> shift) >= 32 || ((panel_height - 1) >> shift) >= SURFACE_DIRTY_TILE_ROWS) {
+        ++shift;
+    }
+    dirty->tile_shift = shift;
+}
+
+static void qp_surface_set_all_tiles(surface_dirty_data_t *dirty, uint16_t panel_width, uint16_t panel_height, bool is_dirty) {
+    uint16_t cols = ((panel_width - 1) >> dirty->tile_shift) + 1;
+    uint16_t rows = ((panel_height - 1) >> dirty->tile_shift) + 1;
+    uint32_t mask = (cols >= 32) ? UINT32_MAX : ((1UL << cols) - 1);
+    for (uint16_t row = 0; row < SURFACE_DIRTY_TILE_ROWS; ++row) {
+        dirty->tiles[row] = (is_dirty && row < rows) ? mask : 0;
+    }
+}
+
+typedef bool (*qp_surface_region_func_t)(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+
+// Invokes the callback for each rectangle of dirty tiles, clipped to the dirty region -- horizontally adjacent tiles are
+// merged, as are consecutive rows of tiles with the same dirty columns
+static bool qp_surface_for_each_dirty_region(const surface_dirty_data_t *dirty, uint16_t panel_width, uint16_t panel_height, qp_surface_region_func_t callback, void *cb_arg) {
+    uint8_t  shift = dirty->tile_shift;
+    uint16_t rows  = ((panel_height - 1) >> shift) + 1;
+    uint16_t row   = 0;
+    while (row < rows) {
+        uint32_t mask = dirty->tiles[row];
+        if (mask == 0) {
+            ++row;
+            continue;
+        }
+
+        // Merge the following rows if they've got the same dirty tiles
+        uint16_t last_row = row;
+        while (last_row + 1 < rows && dirty->tiles[last_row + 1] == mask) {
+            ++last_row;
+        }
+
+        uint16_t t = QP_MAX(row << shift, dirty->t);
+        uint16_t b = QP_MIN(((last_row + 1) << shift) - 1, QP_MIN(dirty->b, panel_height - 1));
+
+        // Send each horizontal run of dirty tiles
+        uint8_t col = 0;
+        while (mask != 0) {
+            uint8_t skip = __builtin_ctzl(mask);
+            col += skip;
+            mask >>= skip;
+            uint8_t run = (mask == UINT32_MAX) ? 32 : __builtin_ctzl(~mask);
+
+            uint16_t l = QP_MAX(col << shift, dirty->l);
+            uint16_t r = QP_MIN(((col + run) << shift) - 1, QP_MIN(dirty->r, panel_width - 1));
+            if (l <= r && t <= b && !callback(cb_arg, l, t, r, b)) {
+                return false;
+            }
+
+            col += run;
+            mask = (run == 32) ? 0 : (mask >> run);
+        }
+
+        row = last_row + 1;
+    }
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +134,7 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.r        = surface->base.panel_width - 1;
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
+    qp_surface_set_all_tiles(&surface->dirty, driver->panel_width, driver->panel_height, true);
 
     return true;
 }
@@ -83,6 +156,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    qp_surface_set_all_tiles(&surface->dirty, driver->panel_width, driver->panel_height, false);
     return true;
 }
 
@@ -105,6 +179,19 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
+typedef struct qp_surface_draw_args_t {
+    painter_driver_t *surface_driver;
+    painter_driver_t *target_driver;
+    uint16_t          x;
+    uint16_t          y;
+} qp_surface_draw_args_t;
+
+static bool qp_surface_draw_region(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    qp_surface_draw_args_t *         args   = (qp_surface_draw_args_t *)cb_arg;
+    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)args->surface_driver->driver_vtable;
+    return vtable->target_pixdata_transfer(args->surface_driver, args->target_driver, args->x, args->y, l, t, r, b);
+}
+
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
@@ -122,9 +209,14 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
-    // Offload to the pixdata transfer function
-    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
+    // Offload each dirty region to the pixdata transfer function
+    qp_surface_draw_args_t args = {.surface_driver = surface_driver, .target_driver = target_driver, .x = x, .y = y};
+    bool                   ok;
+    if (entire_surface) {
+        ok = qp_surface_draw_region(&args, 0, 0, surface_driver->panel_width - 1, surface_driver->panel_height - 1);
+    } else {
+        ok = qp_surface_for_each_dirty_region(&surface_handle->dirty, surface_driver->panel_width, surface_driver->panel_height, qp_surface_draw_region, &args);
+    }
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
         return false;
@@ -139,3 +231,171 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compositing routines to flatten several layered surfaces and send the dirty regions to another device
+
+bool qp_surface_set_transparent_color(painter_device_t surface, uint8_t hue, uint8_t sat, uint8_t val) {
+    painter_driver_t *        surface_driver = (painter_driver_t *)surface;
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+    if (!surface_driver->driver_vtable->palette_convert(surface, 1, &color)) {
+        qp_dprintf("qp_surface_set_transparent_color: fail (could not convert color)\n");
+        return false;
+    }
+
+    surface_handle->transparent_native  = (surface_driver->native_bits_per_pixel == 16) ? color.rgb565 : color.mono;
+    surface_handle->transparent_enabled = true;
+    qp_dprintf("qp_surface_set_transparent_color: ok\n");
+    return true;
+}
+
+static inline uint16_t qp_surface_get_native_pixel(surface_painter_device_t *surface, uint16_t x, uint16_t y) {
+    uint32_t pixel_num = y * surface->base.panel_width + x;
+    if (surface->base.native_bits_per_pixel == 16) {
+        return surface->u16buffer[pixel_num];
+    }
+    return (surface->u8buffer[pixel_num / 8] >> (pixel_num % 8)) & 1;
+}
+
+typedef struct qp_surface_compose_args_t {
+    surface_painter_device_t **layers;
+    uint8_t                    num_layers;
+    painter_device_t           target;
+    uint16_t                   x;
+    uint16_t                   y;
+} qp_surface_compose_args_t;
+
+static bool qp_surface_compose_region(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    qp_surface_compose_args_t *args          = (qp_surface_compose_args_t *)cb_arg;
+    painter_driver_t *         target_driver = (painter_driver_t *)args->target;
+    uint8_t                    bpp           = target_driver->native_bits_per_pixel;
+
+    // Keep the target's comms running for the whole transfer, so that each buffer can be filled while the previous one is still being sent
+    if (!qp_comms_start(args->target)) {
+        qp_dprintf("qp_surface_compose: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Set the target drawing area
+    bool ok = target_driver->driver_vtable->viewport(args->target, args->x + l, args->y + t, args->x + r, args->y + b);
+    if (!ok) {
+        qp_dprintf("qp_surface_compose: fail (could not set target viewport)\n");
+        qp_comms_stop(args->target);
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / bpp;
+    uint32_t pixel_counter     = 0;
+    uint8_t *target_buffer     = qp_internal_global_pixdata_buffer;
+
+    for (uint16_t py = t; ok && py <= b; ++py) {
+        for (uint16_t px = l; px <= r; ++px) {
+            // Take the pixel from the top-most layer that isn't transparent here, the bottom layer is always opaque
+            uint8_t  layer = args->num_layers - 1;
+            uint16_t pixel = qp_surface_get_native_pixel(args->layers[layer], px, py);
+            while (layer > 0 && args->layers[layer]->transparent_enabled && pixel == args->layers[layer]->transparent_native) {
+                --layer;
+                pixel = qp_surface_get_native_pixel(args->layers[layer], px, py);
+            }
+
+            // Update the target buffer
+            if (bpp == 16) {
+                ((uint16_t *)target_buffer)[pixel_counter] = pixel;
+            } else if (pixel) {
+                target_buffer[pixel_counter / 8] |= (1 << (pixel_counter % 8));
+            } else {
+                target_buffer[pixel_counter / 8] &= ~(1 << (pixel_counter % 8));
+            }
+
+            // If we've accumulated enough data, send it
+            if (++pixel_counter == total_pixel_count) {
+                ok = qp_internal_pixdata_flip(args->target, pixel_counter);
+                if (!ok) {
+                    qp_dprintf("qp_surface_compose: fail (could not stream pixdata to target)\n");
+                    break;
+                }
+                // Carry on in the next buffer
+                target_buffer = qp_internal_global_pixdata_buffer;
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_pixdata_flip(args->target, pixel_counter);
+        if (!ok) {
+            qp_dprintf("qp_surface_compose: fail (could not stream pixdata to target)\n");
+        }
+    }
+
+    qp_comms_stop(args->target);
+    return ok;
+}
+
+bool qp_surface_compose(painter_device_t *layers, uint8_t num_layers, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
+    painter_driver_t *target_driver = (painter_driver_t *)target;
+
+    if (num_layers == 0) {
+        qp_dprintf("qp_surface_compose: fail (no layers)\n");
+        return false;
+    }
+
+    // All layers need to match the bottom layer, which in turn needs to match the target
+    painter_driver_t *bottom_driver = (painter_driver_t *)layers[0];
+    if (bottom_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel || (bottom_driver->native_bits_per_pixel != 16 && bottom_driver->native_bits_per_pixel != 1)) {
+        qp_dprintf("qp_surface_compose: fail (incompatible bpp: surface=%d, target=%d)\n", (int)bottom_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Merge the dirty info of all the layers
+    surface_dirty_data_t dirty = {.is_dirty = false, .l = UINT16_MAX, .t = UINT16_MAX, .r = 0, .b = 0, .tile_shift = ((surface_painter_device_t *)bottom_driver)->dirty.tile_shift};
+    for (uint8_t i = 0; i < num_layers; ++i) {
+        painter_driver_t *        layer_driver = (painter_driver_t *)layers[i];
+        surface_painter_device_t *layer_handle = (surface_painter_device_t *)layer_driver;
+        if (layer_driver->panel_width != bottom_driver->panel_width || layer_driver->panel_height != bottom_driver->panel_height || layer_driver->native_bits_per_pixel != bottom_driver->native_bits_per_pixel) {
+            qp_dprintf("qp_surface_compose: fail (layer %d does not match the bottom layer)\n", (int)i);
+            return false;
+        }
+        if (layer_handle->dirty.is_dirty) {
+            dirty.is_dirty = true;
+            dirty.l        = QP_MIN(dirty.l, layer_handle->dirty.l);
+            dirty.t        = QP_MIN(dirty.t, layer_handle->dirty.t);
+            dirty.r        = QP_MAX(dirty.r, layer_handle->dirty.r);
+            dirty.b        = QP_MAX(dirty.b, layer_handle->dirty.b);
+            for (uint16_t row = 0; row < SURFACE_DIRTY_TILE_ROWS; ++row) {
+                dirty.tiles[row] |= layer_handle->dirty.tiles[row];
+            }
+        }
+    }
+
+    // If we're not dirty... we're done.
+    if (!dirty.is_dirty && !entire_surface) {
+        qp_dprintf("qp_surface_compose: ok (not dirty, skipping)\n");
+        return true;
+    }
+
+    qp_surface_compose_args_t args = {.layers = (surface_painter_device_t **)layers, .num_layers = num_layers, .target = target, .x = x, .y = y};
+    bool                      ok;
+    if (entire_surface) {
+        ok = qp_surface_compose_region(&args, 0, 0, bottom_driver->panel_width - 1, bottom_driver->panel_height - 1);
+    } else {
+        ok = qp_surface_for_each_dirty_region(&dirty, bottom_driver->panel_width, bottom_driver->panel_height, qp_surface_compose_region, &args);
+    }
+    if (!ok) {
+        return false;
+    }
+
+    // Clear the dirty info for all the layers
+    for (uint8_t i = 0; i < num_layers; ++i) {
+        if (!qp_flush(layers[i])) {
+            qp_dprintf("qp_surface_compose: fail (could not flush layer %d)\n", (int)i);
+            return false;
+        }
+    }
+    qp_dprintf("qp_surface_compose: ok\n");
+    return true;
+}
@@ -13,7 +13,8 @@
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
-    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+    // Transfers the region (l, t)-(r, b) of the surface to the target, positioned as if the surface were drawn at (x, y)
+    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 } surface_painter_driver_vtable_t;
 
 typedef struct surface_dirty_data_t {
@@ -22,6 +23,10 @@ typedef struct surface_dirty_data_t {
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Dirty tiles, one bit per tile and one word per row of tiles -- each tile is (1 << tile_shift) pixels square
+    uint8_t  tile_shift;
+    uint32_t tiles[SURFACE_DIRTY_TILE_ROWS];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -52,6 +57,10 @@ typedef struct surface_painter_device_t {
 
     // Maintain a dirty region so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Native pixel value which lets lower layers show through when compositing
+    bool     transparent_enabled;
+    uint16_t transparent_native;
 } surface_painter_device_t;
 
 /**
@@ -89,6 +98,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_setup_dirty_tiles(surface_dirty_data_t *dirty, uint16_t panel_width, uint16_t panel_height);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -109,6 +119,7 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
                 driver->base.offset_x              = 0;                                                                                                                       \
                 driver->base.offset_y              = 0;                                                                                                                       \
                 driver->buffer                     = buffer;                                                                                                                  \
+                qp_surface_setup_dirty_tiles(&driver->dirty, panel_width, panel_height);                                                                                      \
                 return (painter_device_t)driver;                                                                                                                              \
             }                                                                                                                                                                 \
         }                                                                                                                                                                     \
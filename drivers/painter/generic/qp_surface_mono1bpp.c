@@ -4,6 +4,7 @@
 #ifdef QUANTUM_PAINTER_SURFACE_ENABLE
 
 #    include "color.h"
+#    include "qp_comms.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
 #    include "qp_comms_dummy.h"
@@ -84,8 +85,64 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
-static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_device_t          target         = (painter_device_t)target_driver;
+
+    // Keep the target's comms running for the whole transfer, so that each buffer can be filled while the previous one is still being sent
+    if (!qp_comms_start(target)) {
+        qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Set the target drawing area
+    bool ok = target_driver->driver_vtable->viewport(target, x + l, y + t, x + r, y + b);
+    if (!ok) {
+        qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_comms_stop(target);
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = 8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE;
+    uint32_t pixel_counter     = 0;
+    uint8_t *target_buffer     = qp_internal_global_pixdata_buffer;
+
+    // Fill the global pixdata area so that we can start transferring to the panel
+    for (uint16_t row = t; ok && row <= b; ++row) {
+        for (uint16_t col = l; col <= r; ++col) {
+            // Update the target buffer, the region doesn't necessarily start on a byte boundary within the surface
+            uint32_t src_num = row * surface_handle->base.panel_width + col;
+            if (surface_handle->u8buffer[src_num / 8] & (1 << (src_num % 8))) {
+                target_buffer[pixel_counter / 8] |= (1 << (pixel_counter % 8));
+            } else {
+                target_buffer[pixel_counter / 8] &= ~(1 << (pixel_counter % 8));
+            }
+
+            // If we've accumulated enough data, send it
+            if (++pixel_counter == total_pixel_count) {
+                ok = qp_internal_pixdata_flip(target, pixel_counter);
+                if (!ok) {
+                    qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    break;
+                }
+                // Carry on in the next buffer
+                target_buffer = qp_internal_global_pixdata_buffer;
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_pixdata_flip(target, pixel_counter);
+        if (!ok) {
+            qp_dprintf("mono1bpp_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+        }
+    }
+
+    qp_comms_stop(target);
+    return ok;
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -4,6 +4,7 @@
 #ifdef QUANTUM_PAINTER_SURFACE_ENABLE
 
 #    include "color.h"
+#    include "qp_comms.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
 #    include "qp_comms_dummy.h"
@@ -51,11 +52,7 @@ static bool qp_surface_pixdata_rgb565(painter_device_t device, const void *pixel
 
 // Pixel colour conversion
 static bool qp_surface_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
-    for (int16_t i = 0; i < palette_size; ++i) {
-        rgb_t    rgb      = hsv_to_rgb_nocie((hsv_t){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
-        uint16_t rgb565   = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
-        palette[i].rgb565 = __builtin_bswap16(rgb565);
-    }
+    qp_internal_palette_convert_rgb565_swapped(palette, palette_size);
     return true;
 }
 
@@ -68,18 +65,21 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    painter_device_t          target         = (painter_device_t)target_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    // Keep the target's comms running for the whole transfer, so that each buffer can be filled while the previous one is still being sent
+    if (!qp_comms_start(target)) {
+        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not start comms)\n");
+        return false;
+    }
 
     // Set the target drawing area
-    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    bool ok = target_driver->driver_vtable->viewport(target, x + l, y + t, x + r, y + b);
     if (!ok) {
         qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_comms_stop(target);
         return false;
     }
 
@@ -89,34 +89,35 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
-        for (uint16_t x = l; x <= r; ++x) {
+    for (uint16_t row = t; ok && row <= b; ++row) {
+        for (uint16_t col = l; col <= r; ++col) {
             // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
+            target_buffer[pixel_counter++] = surface_handle->u16buffer[row * surface_handle->base.panel_width + col];
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                ok = qp_internal_pixdata_flip(target, pixel_counter);
                 if (!ok) {
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-                    return false;
+                    break;
                 }
-                // Reset the counter
+                // Carry on in the next buffer
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
                 pixel_counter = 0;
             }
         }
     }
 
     // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_pixdata_flip(target, pixel_counter);
         if (!ok) {
             qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-            return false;
         }
     }
 
-    return true;
+    qp_comms_stop(target);
+    return ok;
 }
 
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -142,4 +143,132 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Anti-aliased shapes
+//
+// Coordinates are in eighths of a pixel relative to the shape's center, with each pixel sampled on a 4x4 grid. Ellipse
+// boundaries lie half a pixel beyond the radius, matching the extent of the aliased shapes.
+
+static const int8_t aa_sample_offsets[4] = {-3, -1, 1, 3};
+
+typedef struct aa_ellipse_t {
+    int64_t a; // semi-axes, in eighths of a pixel -- the ellipse is empty if either is zero
+    int64_t b;
+} aa_ellipse_t;
+
+static uint32_t aa_isqrt(uint64_t n) {
+    uint64_t root = 0;
+    uint64_t bit  = 1ull << 62;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+static inline bool aa_inside(const aa_ellipse_t *e, int64_t x, int64_t y) {
+    return e->a > 0 && e->b > 0 && x * x * e->b * e->b + y * y * e->a * e->a <= e->a * e->a * e->b * e->b;
+}
+
+// Works out the half-width of the ellipse at the supplied offset from its center, or -1 if outside of the ellipse
+static int64_t aa_half_width(const aa_ellipse_t *e, int64_t y) {
+    if (e->a <= 0 || e->b <= 0 || y > e->b) {
+        return -1;
+    }
+    return e->a * aa_isqrt(e->b * e->b - y * y) / e->b;
+}
+
+// Works out how many of the pixel's samples are within the shape
+static uint8_t aa_coverage(const aa_ellipse_t *outer, const aa_ellipse_t *inner, int32_t dx, int32_t dy) {
+    uint8_t coverage = 0;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            int64_t sx = dx * 8 + aa_sample_offsets[j];
+            int64_t sy = dy * 8 + aa_sample_offsets[i];
+            if (aa_inside(outer, sx, sy) && !(inner && aa_inside(inner, sx, sy))) {
+                ++coverage;
+            }
+        }
+    }
+    return coverage;
+}
+
+// Blends the color into the existing pixel, weighted by the number of samples covered
+static void aa_blend_pixel(surface_painter_device_t *surface, int32_t x, int32_t y, uint16_t rgb565, uint8_t coverage) {
+    uint16_t w = surface->base.panel_width;
+    uint16_t h = surface->base.panel_height;
+    if (coverage == 0 || x < 0 || y < 0 || x >= w || y >= h) {
+        return;
+    }
+
+    if (coverage < 16) {
+        // Surfaces hold pixels in transmission order, i.e. big-endian
+        uint16_t dst = __builtin_bswap16(surface->u16buffer[y * w + x]);
+        uint16_t r   = ((rgb565 >> 11) * coverage + (dst >> 11) * (16 - coverage)) / 16;
+        uint16_t g   = (((rgb565 >> 5) & 0x3F) * coverage + ((dst >> 5) & 0x3F) * (16 - coverage)) / 16;
+        uint16_t b   = ((rgb565 & 0x1F) * coverage + (dst & 0x1F) * (16 - coverage)) / 16;
+        rgb565       = r << 11 | g << 5 | b;
+    }
+    setpixel_rgb565(surface, x, y, __builtin_bswap16(rgb565));
+}
+
+bool qp_surface_ellipse_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    painter_driver_t *        driver  = (painter_driver_t *)device;
+    surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+    if (!driver || !driver->validate_ok || driver->driver_vtable != (const painter_driver_vtable_t *)&rgb565_surface_driver_vtable) {
+        qp_dprintf("qp_surface_ellipse_aa: fail (not an rgb565 surface)\n");
+        return false;
+    }
+
+    qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
+    qp_surface_palette_convert_rgb565_swapped(device, 1, &color);
+    uint16_t rgb565 = __builtin_bswap16(color.rgb565);
+
+    // Outlines are a pixel wide, centered on the aliased outline
+    aa_ellipse_t  outer = {.a = sizex * 8 + 4, .b = sizey * 8 + 4};
+    aa_ellipse_t  inner = {.a = sizex * 8 - 4, .b = sizey * 8 - 4};
+    aa_ellipse_t *hole  = filled ? NULL : &inner;
+
+    for (int32_t dy = -(int32_t)sizey - 1; dy <= (int32_t)sizey + 1; ++dy) {
+        int64_t abs_dy = (dy < 0) ? -dy : dy;
+        int64_t near_y = QP_MAX(0, abs_dy * 8 - 3);
+        int64_t far_y  = abs_dy * 8 + 3;
+
+        // Pixels beyond the outer extent of the row aren't covered at all
+        int64_t outer_width = aa_half_width(&outer, near_y);
+        if (outer_width < 0) {
+            continue;
+        }
+        int32_t extent = (int32_t)((outer_width + 3) / 8) + 1;
+
+        // Pixels entirely within the shape, or entirely within the hole of an outline, don't need sampling
+        int64_t solid_width = aa_half_width(filled ? &outer : &inner, far_y);
+        int32_t solid       = (solid_width >= 3) ? (int32_t)((solid_width - 3) / 8) - 1 : -1;
+        for (int32_t dx = -solid; filled && dx <= solid; ++dx) {
+            aa_blend_pixel(surface, x + dx, y + dy, rgb565, 16);
+        }
+
+        for (int32_t dx = solid + 1; dx <= extent; ++dx) {
+            aa_blend_pixel(surface, x + dx, y + dy, rgb565, aa_coverage(&outer, hole, dx, dy));
+            if (dx != 0) {
+                aa_blend_pixel(surface, x - dx, y + dy, rgb565, aa_coverage(&outer, hole, -dx, dy));
+            }
+        }
+    }
+
+    return true;
+}
+
+bool qp_surface_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    return qp_surface_ellipse_aa(device, x, y, radius, radius, hue, sat, val, filled);
+}
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -78,10 +78,11 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
     return true;
 }
 
-// Stream pixel data to the current write position in GRAM
+// Stream pixel data to the current write position in GRAM -- the transfer may still be in progress on return, and is
+// completed before any further comms with the panel
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
-    qp_comms_send(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+    qp_comms_send_async(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
     return true;
 }
 
@@ -89,11 +90,7 @@ bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint3
 // Convert supplied palette entries into their native equivalents
 
 bool qp_tft_panel_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
-    for (int16_t i = 0; i < palette_size; ++i) {
-        rgb_t    rgb      = hsv_to_rgb_nocie((hsv_t){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
-        uint16_t rgb565   = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
-        palette[i].rgb565 = __builtin_bswap16(rgb565);
-    }
+    qp_internal_palette_convert_rgb565_swapped(palette, palette_size);
     return true;
 }
 
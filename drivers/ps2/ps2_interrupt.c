@@ -54,6 +54,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "ps2_io.h"
 #include "print.h"
 #include "wait.h"
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+#    include "ps2_mouse.h"
+#endif
 
 #define WAIT(stat, us, err)     \
     do {                        \
@@ -230,6 +233,9 @@ void ps2_interrupt_service_routine(void) {
             break;
         case STOP:
             if (!data_in()) goto ERROR;
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+            if (ps2_mouse_packet_receive(data, true)) goto DONE;
+#endif
             pbuf_enqueue(data);
             goto DONE;
             break;
@@ -239,6 +245,9 @@ void ps2_interrupt_service_routine(void) {
     goto RETURN;
 ERROR:
     ps2_error = state;
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    ps2_mouse_packet_receive(data, false);
+#endif
 DONE:
     state  = INIT;
     data   = 0;
@@ -32,9 +32,14 @@ static report_mouse_t mouse_report = {};
 
 static inline void ps2_mouse_print_report(report_mouse_t *mouse_report);
 static inline void ps2_mouse_convert_report_to_hid(report_mouse_t *mouse_report);
+static inline void ps2_mouse_orient_report(report_mouse_t *mouse_report);
 static inline void ps2_mouse_clear_report(report_mouse_t *mouse_report);
 static inline void ps2_mouse_enable_scrolling(void);
 static inline void ps2_mouse_scroll_button_task(report_mouse_t *mouse_report);
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+static void ps2_mouse_packet_queue_enable(bool enable);
+static bool ps2_mouse_packet_queue_take(report_mouse_t *mouse_report);
+#endif
 
 /* ============================= IMPLEMENTATION ============================ */
 
@@ -64,6 +69,10 @@ void ps2_mouse_init(void) {
     ps2_mouse_set_scaling_2_1();
 #endif
 
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    ps2_mouse_packet_queue_enable(true);
+#endif
+
     ps2_mouse_init_user();
 }
 
@@ -91,6 +100,10 @@ void ps2_mouse_task(void) {
         /* return here to avoid updating the mouse button state */
         return;
     }
+#elif defined(PS2_MOUSE_USE_PACKET_QUEUE)
+    if (!ps2_mouse_packet_queue_take(&mouse_report)) {
+        return;
+    }
 #else
     if (pbuf_has_data()) {
         mouse_report.buttons = ps2_host_recv_response();
@@ -114,7 +127,12 @@ void ps2_mouse_task(void) {
         ps2_mouse_print_report(&mouse_report);
 #endif
         buttons_prev = mouse_report.buttons;
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+        // packets were decoded and scaled as they were queued
+        ps2_mouse_orient_report(&mouse_report);
+#else
         ps2_mouse_convert_report_to_hid(&mouse_report);
+#endif
 #if PS2_MOUSE_SCROLL_BTN_MASK
         ps2_mouse_scroll_button_task(&mouse_report);
 #endif
@@ -131,12 +149,25 @@ void ps2_mouse_task(void) {
     ps2_mouse_clear_report(&mouse_report);
 }
 
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+static bool packet_queue_ready = false;
+#endif
+
 void ps2_mouse_disable_data_reporting(void) {
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    // command responses must reach ps2_host_recv_response rather than packet assembly
+    ps2_mouse_packet_queue_enable(false);
+#endif
     PS2_MOUSE_SEND(PS2_MOUSE_DISABLE_DATA_REPORTING, "ps2 mouse disable data reporting");
 }
 
 void ps2_mouse_enable_data_reporting(void) {
     PS2_MOUSE_SEND(PS2_MOUSE_ENABLE_DATA_REPORTING, "ps2 mouse enable data reporting");
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    if (packet_queue_ready) {
+        ps2_mouse_packet_queue_enable(true);
+    }
+#endif
 }
 
 void ps2_mouse_set_remote_mode(void) {
@@ -193,6 +224,10 @@ static inline void ps2_mouse_convert_report_to_hid(report_mouse_t *mouse_report)
 #endif
     mouse_report->v *= PS2_MOUSE_V_MULTIPLIER;
 
+    ps2_mouse_orient_report(mouse_report);
+}
+
+static inline void ps2_mouse_orient_report(report_mouse_t *mouse_report) {
 #ifdef PS2_MOUSE_INVERT_BUTTONS
     // swap left & right buttons
     bool needs_left       = mouse_report->buttons & (1 << PS2_MOUSE_BTN_RIGHT);
@@ -226,6 +261,144 @@ static inline void ps2_mouse_convert_report_to_hid(report_mouse_t *mouse_report)
 #endif
 }
 
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+/*
+ * Packets are assembled in the interrupt that receives each byte, and handed to ps2_mouse_task through a single
+ * producer, single consumer ring: only the interrupt writes packet_head, and only the task writes packet_tail.
+ */
+typedef struct {
+    uint8_t status; // first byte of the packet, with buttons, signs and overflows
+    int16_t x;
+    int16_t y;
+    int8_t  v;
+} ps2_mouse_packet_t;
+
+static ps2_mouse_packet_t packet_queue[PS2_MOUSE_PACKET_QUEUE_SIZE];
+static volatile uint8_t   packet_head      = 0;
+static volatile uint8_t   packet_tail      = 0;
+static volatile bool      packet_receiving = false;
+static uint8_t            packet_bytes[PS2_MOUSE_PACKET_SIZE];
+static uint8_t            packet_length = 0;
+
+/* motion received but not yet reported, after multipliers */
+static struct {
+    int32_t x;
+    int32_t y;
+    int32_t v;
+    uint8_t status;
+} packet_pending;
+
+static inline int16_t ps2_mouse_packet_axis(uint8_t status, uint8_t value, uint8_t sign_bit, uint8_t overflow_bit) {
+    bool negative = status & (1 << sign_bit);
+    if (status & (1 << overflow_bit)) {
+        return negative ? -256 : 255;
+    }
+    return negative ? (int16_t)value - 256 : value;
+}
+
+/**
+ * @brief Assembles a byte received from the mouse into packets. Called from the PS/2 receive interrupt.
+ *
+ * @param[in] data byte received
+ * @param[in] valid false if the byte failed framing or parity checks, which restarts assembly from the next packet
+ * @return true if the byte was taken for a packet, false if it should be queued for ps2_host_recv_response
+ */
+bool ps2_mouse_packet_receive(uint8_t data, bool valid) {
+    if (!packet_receiving) {
+        return false;
+    }
+    // bit 3 of the first byte is always set, which is enough to find the start of a packet again after an error
+    if (!valid || (packet_length == 0 && !(data & (1 << PS2_MOUSE_ALWAYS_1)))) {
+        packet_length = 0;
+        return true;
+    }
+
+    packet_bytes[packet_length++] = data;
+    if (packet_length < PS2_MOUSE_PACKET_SIZE) {
+        return true;
+    }
+    packet_length = 0;
+
+    uint8_t next = (packet_head + 1) % PS2_MOUSE_PACKET_QUEUE_SIZE;
+    if (next == packet_tail) {
+        // full, so the task has not run for many packets; dropping the newest keeps the queue consistent
+        return true;
+    }
+    ps2_mouse_packet_t *packet = &packet_queue[packet_head];
+    packet->status             = packet_bytes[0];
+    packet->x                  = ps2_mouse_packet_axis(packet_bytes[0], packet_bytes[1], PS2_MOUSE_X_SIGN, PS2_MOUSE_X_OVFLW);
+    packet->y                  = ps2_mouse_packet_axis(packet_bytes[0], packet_bytes[2], PS2_MOUSE_Y_SIGN, PS2_MOUSE_Y_OVFLW);
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+    packet->v = -(packet_bytes[3] & PS2_MOUSE_SCROLL_MASK);
+#    else
+    packet->v = 0;
+#    endif
+    // the packet must be complete before the task can see it
+    __asm__ volatile("" ::: "memory");
+    packet_head = next;
+    return true;
+}
+
+static void ps2_mouse_packet_queue_enable(bool enable) {
+    packet_receiving = false;
+    __asm__ volatile("" ::: "memory");
+    packet_length = 0;
+    if (enable) {
+        // drop anything that arrived as bytes before packets were being assembled
+        while (pbuf_has_data()) {
+            ps2_host_recv();
+        }
+        packet_queue_ready = true;
+        packet_receiving   = true;
+    }
+}
+
+static inline int32_t ps2_mouse_packet_take(int32_t *pending, int32_t limit) {
+    int32_t amount = *pending < -limit ? -limit : (*pending > limit ? limit : *pending);
+    *pending -= amount;
+    return amount;
+}
+
+/**
+ * @brief Merges queued packets into a report
+ *
+ * Packets are merged up to a change of buttons, which is left for the next report so that no click is lost. Motion
+ * beyond what a report can hold is carried into the next one.
+ *
+ * @param[out] mouse_report report_mouse_t with buttons in PS/2 status form
+ * @return false if there was nothing to report
+ */
+static bool ps2_mouse_packet_queue_take(report_mouse_t *mouse_report) {
+    bool    received = false;
+    uint8_t tail     = packet_tail;
+    while (tail != packet_head) {
+        const ps2_mouse_packet_t *packet = &packet_queue[tail];
+        if (received && ((packet->status ^ packet_pending.status) & PS2_MOUSE_BTN_MASK)) {
+            break;
+        }
+        packet_pending.status = packet->status;
+        packet_pending.x += (int32_t)packet->x * PS2_MOUSE_X_MULTIPLIER;
+        packet_pending.y += (int32_t)packet->y * PS2_MOUSE_Y_MULTIPLIER;
+        packet_pending.v += (int32_t)packet->v * PS2_MOUSE_V_MULTIPLIER;
+        received = true;
+        tail     = (tail + 1) % PS2_MOUSE_PACKET_QUEUE_SIZE;
+    }
+    // the packets must be read before their slots are handed back
+    __asm__ volatile("" ::: "memory");
+    packet_tail = tail;
+
+    if (!received && !packet_pending.x && !packet_pending.y && !packet_pending.v) {
+        return false;
+    }
+
+    mouse_report->buttons = packet_pending.status;
+    mouse_report->x       = ps2_mouse_packet_take(&packet_pending.x, MOUSE_REPORT_XY_MAX);
+    mouse_report->y       = ps2_mouse_packet_take(&packet_pending.y, MOUSE_REPORT_XY_MAX);
+    mouse_report->v       = ps2_mouse_packet_take(&packet_pending.v, INT8_MAX);
+    return true;
+}
+#endif
+
 static inline void ps2_mouse_clear_report(report_mouse_t *mouse_report) {
     mouse_report->x       = 0;
     mouse_report->y       = 0;
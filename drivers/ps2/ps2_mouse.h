@@ -79,6 +79,7 @@ __attribute__((unused)) static enum ps2_mouse_mode_e {
 #define PS2_MOUSE_BTN_LEFT 0
 #define PS2_MOUSE_BTN_RIGHT 1
 #define PS2_MOUSE_BTN_MIDDLE 2
+#define PS2_MOUSE_ALWAYS_1 3
 #define PS2_MOUSE_X_SIGN 4
 #define PS2_MOUSE_Y_SIGN 5
 #define PS2_MOUSE_X_OVFLW 6
@@ -116,6 +117,20 @@ __attribute__((unused)) static enum ps2_mouse_mode_e {
 #ifndef PS2_MOUSE_INIT_DELAY
 #    define PS2_MOUSE_INIT_DELAY 1000
 #endif
+#ifdef PS2_MOUSE_ENABLE_SCROLLING
+#    define PS2_MOUSE_PACKET_SIZE 4
+#else
+#    define PS2_MOUSE_PACKET_SIZE 3
+#endif
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+#    if defined(PS2_MOUSE_USE_REMOTE_MODE) || defined(PS2_DRIVER_BUSYWAIT)
+#        error "PS2_MOUSE_USE_PACKET_QUEUE requires stream mode and an interrupt driven PS/2 driver"
+#    endif
+/* whole packets held until ps2_mouse_task runs; one slot is always left free */
+#    ifndef PS2_MOUSE_PACKET_QUEUE_SIZE
+#        define PS2_MOUSE_PACKET_QUEUE_SIZE 16
+#    endif
+#endif
 
 enum ps2_mouse_command_e {
     PS2_MOUSE_RESET                  = 0xFF,
@@ -175,3 +190,7 @@ void ps2_mouse_set_resolution(ps2_mouse_resolution_t resolution);
 void ps2_mouse_set_sample_rate(ps2_mouse_sample_rate_t sample_rate);
 
 void ps2_mouse_moved_user(report_mouse_t *mouse_report);
+
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+bool ps2_mouse_packet_receive(uint8_t data, bool valid);
+#endif
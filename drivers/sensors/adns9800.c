@@ -15,6 +15,7 @@
  */
 
 #include "spi_master.h"
+#include "sensor_transfer.h"
 #include "adns9800.h"
 #include "wait.h"
 
@@ -74,7 +75,6 @@
 #define US_BETWEEN_READS    20
 #define US_DELAY_AFTER_ADDR 100
 #define US_BEFORE_MOTION    100
-#define MSB1                0x80
 // clang-format on
 
 const pointing_device_driver_t adns9800_pointing_device_driver = {
@@ -92,26 +92,27 @@ uint8_t __attribute__((weak)) adns9800_srom_get_byte(uint16_t position) {
     return 0;
 }
 
+static const sensor_transfer_t adns9800_transfer = {
+    .cs_pin           = ADNS9800_CS_PIN,
+    .mode             = ADNS9800_SPI_MODE,
+    .divisor          = ADNS9800_SPI_DIVISOR,
+    .address_us       = US_DELAY_AFTER_ADDR,
+    .burst_address_us = US_BEFORE_MOTION,
+    .read_gap_us      = US_BETWEEN_READS,
+    .write_gap_us     = US_BETWEEN_WRITES,
+};
+
 void adns9800_spi_start(void) {
-    spi_start(ADNS9800_CS_PIN, false, ADNS9800_SPI_MODE, ADNS9800_SPI_DIVISOR);
+    sensor_transfer_start(&adns9800_transfer);
 }
 
 void adns9800_write(uint8_t reg_addr, uint8_t data) {
-    adns9800_spi_start();
-    spi_write(reg_addr | MSB1);
-    spi_write(data);
-    spi_stop();
-    wait_us(US_BETWEEN_WRITES);
+    sensor_transfer_write(&adns9800_transfer, reg_addr, data);
 }
 
 uint8_t adns9800_read(uint8_t reg_addr) {
-    adns9800_spi_start();
-    spi_write(reg_addr & 0x7f);
-    wait_us(US_DELAY_AFTER_ADDR);
-    uint8_t data = spi_read();
-    spi_stop();
-    wait_us(US_BETWEEN_READS);
-
+    uint8_t data = 0;
+    sensor_transfer_read(&adns9800_transfer, reg_addr, &data, sizeof(data));
     return data;
 }
 
@@ -222,34 +223,33 @@ static int16_t convertDeltaToInt(uint8_t high, uint8_t low) {
 report_adns9800_t adns9800_get_report(void) {
     report_adns9800_t report = {0};
 
-    adns9800_spi_start();
+    if (!sensor_transfer_start(&adns9800_transfer)) {
+        return report;
+    }
 
     // start burst mode
-    spi_write(REG_Motion_Burst & 0x7f);
-
-    wait_us(US_BEFORE_MOTION);
+    bool success = spi_write(REG_Motion_Burst & 0x7f) >= 0;
 
-    uint8_t motion = spi_read();
-
-    if (motion & 0x80) {
-        // clear observation register
-        spi_read();
-
-        // delta registers
-        uint8_t delta_x_l = spi_read();
-        uint8_t delta_x_h = spi_read();
-        uint8_t delta_y_l = spi_read();
-        uint8_t delta_y_h = spi_read();
-
-        report.x = convertDeltaToInt(delta_x_h, delta_x_l);
-        report.y = convertDeltaToInt(delta_y_h, delta_y_l);
+    // motion, observation, and delta registers, received in one transfer
+    uint8_t burst[6];
+    if (success) {
+        sensor_transfer_wait_us(US_BEFORE_MOTION);
+        success = spi_receive(burst, sizeof(burst)) == SPI_STATUS_SUCCESS;
     }
 
-    // clear residual motion
-    spi_write(REG_Motion & 0x7f);
+    if (success) {
+        // clear residual motion
+        spi_write(REG_Motion & 0x7f);
+    }
 
     spi_stop();
 
+    // the deltas only hold motion when the MOT bit is set
+    if (success && (burst[0] & 0x80)) {
+        report.x = convertDeltaToInt(burst[3], burst[2]);
+        report.y = convertDeltaToInt(burst[5], burst[4]);
+    }
+
     return report;
 }
 
@@ -4,6 +4,7 @@
 
 #include "azoteq_iqs5xx.h"
 #include "pointing_device_internal.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifndef AZOTEQ_IQS5XX_ADDRESS
@@ -401,11 +402,25 @@ report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
             temp_report.h = CONSTRAIN_HID(AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.x.h, base_data.x.l));
             temp_report.v = CONSTRAIN_HID(AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.y.h, base_data.y.l));
         }
-        if (base_data.number_of_fingers == 1 && !ignore_movement) {
-            temp_report.x = CONSTRAIN_HID_XY(AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.x.h, base_data.x.l));
-            temp_report.y = CONSTRAIN_HID_XY(AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.y.h, base_data.y.l));
-        }
 
+        // The sensor reports relative motion, summed here into a position for the touch gesture engine
+        static uint16_t x = 0, y = 0;
+        x += AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.x.h, base_data.x.l);
+        y += AZOTEQ_IQS5XX_COMBINE_H_L_BYTES(base_data.y.h, base_data.y.l);
+        // Contacts the sensor has clicked for are claimed when lifted, so the gesture engine doesn't tap on top of them
+        static bool sensor_clicked = false;
+        sensor_clicked |= base_data.gesture_events_0.single_tap || base_data.gesture_events_0.press_and_hold || base_data.gesture_events_1.two_finger_tap;
+        // Taps, swipes, zoom and multi-finger scroll are left to the sensor's own gesture detection
+        pointing_device_touch_push((touch_event_t){
+            .timestamp = timer_read(),
+            .x         = x,
+            .y         = y,
+            .fingers   = base_data.number_of_fingers,
+            .claimed   = ignore_movement || (base_data.number_of_fingers > 1 && AZOTEQ_IQS5XX_SCROLL_ENABLE) || (sensor_clicked && !base_data.number_of_fingers),
+        });
+        if (!base_data.number_of_fingers) {
+            sensor_clicked = false;
+        }
     } else {
         pd_dprintf("IQS5XX - get report failed, i2c status: %d \n", status);
     }
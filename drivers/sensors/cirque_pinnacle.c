@@ -354,20 +354,12 @@ pinnacle_data_t cirque_pinnacle_read_data(void) {
 }
 
 #ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-static bool cursor_glide_enable = true;
-
-static cursor_glide_context_t glide = {.config = {
-                                           .coef       = 102, /* Good default friction coef */
-                                           .interval   = 10,  /* 100sps */
-                                           .trigger_px = 10,  /* Default threshold in case of hover, set to 0 if you'd like */
-                                       }};
-
 void cirque_pinnacle_enable_cursor_glide(bool enable) {
-    cursor_glide_enable = enable;
+    pointing_device_touch_enable_cursor_glide(enable);
 }
 
 void cirque_pinnacle_configure_cursor_glide(float trigger_px) {
-    glide.config.trigger_px = trigger_px;
+    pointing_device_touch_configure_cursor_glide(trigger_px);
 }
 #endif
 
@@ -382,73 +374,39 @@ bool auto_mouse_activation(report_mouse_t mouse_report) {
 #    endif
 
 report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
-    uint16_t          scale     = cirque_pinnacle_get_scale();
-    pinnacle_data_t   touchData = cirque_pinnacle_read_data();
-    mouse_xy_report_t report_x = 0, report_y = 0;
-    static uint16_t   x = 0, y = 0, last_scale = 0;
-
-#    if defined(CIRQUE_PINNACLE_TAP_ENABLE)
-    mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, false, POINTING_DEVICE_BUTTON1);
-#    endif
-#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-    cursor_glide_t glide_report = {0};
+    uint16_t        scale     = cirque_pinnacle_get_scale();
+    pinnacle_data_t touchData = cirque_pinnacle_read_data();
+    static uint16_t last_scale = 0;
 
-    if (cursor_glide_enable) {
-        glide_report = cursor_glide_check(&glide);
-    }
-#    endif
+    mouse_report.x = 0;
+    mouse_report.y = 0;
+    mouse_report.h = 0;
+    mouse_report.v = 0;
 
-    if (!touchData.valid) {
-#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-        if (cursor_glide_enable && glide_report.valid) {
-            report_x = glide_report.dx;
-            report_y = glide_report.dy;
-            goto mouse_report_update;
+    if (touchData.valid) {
+        if (touchData.touchDown) {
+            pd_dprintf("cirque_pinnacle touchData x=%4d y=%4d z=%2d\n", touchData.xValue, touchData.yValue, touchData.zValue);
         }
-#    endif
-        return mouse_report;
-    }
-
-    if (touchData.touchDown) {
-        pd_dprintf("cirque_pinnacle touchData x=%4d y=%4d z=%2d\n", touchData.xValue, touchData.yValue, touchData.zValue);
-    }
 
 #    ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
-    is_touch_down = touchData.touchDown;
+        is_touch_down = touchData.touchDown;
 #    endif
 
-    // Scale coordinates to arbitrary X, Y resolution
-    cirque_pinnacle_scale_data(&touchData, scale, scale);
+        // Scale coordinates to arbitrary X, Y resolution
+        cirque_pinnacle_scale_data(&touchData, scale, scale);
 
-    if (!cirque_pinnacle_gestures(&mouse_report, touchData)) {
-        if (last_scale && scale == last_scale && x && y && touchData.xValue && touchData.yValue) {
-            report_x = CONSTRAIN_HID_XY((int16_t)(touchData.xValue - x));
-            report_y = CONSTRAIN_HID_XY((int16_t)(touchData.yValue - y));
-        }
-        x          = touchData.xValue;
-        y          = touchData.yValue;
-        last_scale = scale;
-
-#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-        if (cursor_glide_enable) {
-            if (touchData.touchDown) {
-                cursor_glide_update(&glide, report_x, report_y, touchData.zValue);
-            } else if (!glide_report.valid) {
-                glide_report = cursor_glide_start(&glide);
-                if (glide_report.valid) {
-                    report_x = glide_report.dx;
-                    report_y = glide_report.dy;
-                }
-            }
-        }
-#    endif
-    }
+        // Coordinates are zero when the sensor has lost track of the finger, and can't be compared across a change of scale
+        bool claimed = cirque_pinnacle_gestures(&mouse_report, touchData) || scale != last_scale || !touchData.xValue || !touchData.yValue;
+        last_scale   = scale;
 
-#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-mouse_report_update:
-#    endif
-    mouse_report.x = report_x;
-    mouse_report.y = report_y;
+        pointing_device_touch_push((touch_event_t){
+            .timestamp = timer_read(),
+            .x         = touchData.xValue,
+            .y         = touchData.yValue,
+            .fingers   = touchData.touchDown,
+            .claimed   = claimed,
+        });
+    }
 
     return mouse_report;
 }
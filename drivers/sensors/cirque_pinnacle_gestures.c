@@ -24,32 +24,13 @@
 #    include "keyboard.h"
 #endif
 
-#if (defined(CIRQUE_PINNACLE_TAP_ENABLE) || defined(CIRQUE_PINNACLE_CIRCULAR_SCROLL_ENABLE)) && CIRQUE_PINNACLE_POSITION_MODE
-static cirque_pinnacle_features_t features = {.tap_enable = true, .circular_scroll_enable = true};
+#ifdef CIRQUE_PINNACLE_CIRCULAR_SCROLL_ENABLE
+static cirque_pinnacle_features_t features = {.circular_scroll_enable = true};
 #endif
 
 #if defined(CIRQUE_PINNACLE_TAP_ENABLE) && CIRQUE_PINNACLE_POSITION_MODE
-static trackpad_tap_context_t tap;
-
-static report_mouse_t trackpad_tap(report_mouse_t mouse_report, pinnacle_data_t touchData) {
-    if (touchData.touchDown != tap.touchDown) {
-        tap.touchDown = touchData.touchDown;
-        if (!touchData.zValue) {
-            if (timer_elapsed(tap.timer) < CIRQUE_PINNACLE_TAPPING_TERM && tap.timer != 0) {
-                mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, true, POINTING_DEVICE_BUTTON1);
-            }
-        }
-        tap.timer = timer_read();
-    }
-    if (timer_elapsed(tap.timer) > (CIRQUE_PINNACLE_TOUCH_DEBOUNCE)) {
-        tap.timer = 0;
-    }
-
-    return mouse_report;
-}
-
 void cirque_pinnacle_enable_tap(bool enable) {
-    features.tap_enable = enable;
+    pointing_device_touch_enable_tap(enable);
 }
 #endif
 
@@ -220,11 +201,5 @@ bool cirque_pinnacle_gestures(report_mouse_t* mouse_report, pinnacle_data_t touc
     }
 #endif
 
-#if defined(CIRQUE_PINNACLE_TAP_ENABLE) && CIRQUE_PINNACLE_POSITION_MODE
-    if (features.tap_enable) {
-        *mouse_report = trackpad_tap(*mouse_report, touchData);
-    }
-#endif
-
     return suppress_mouse_update;
 }
@@ -20,24 +20,11 @@
 #include "report.h"
 
 typedef struct {
-    bool tap_enable;
     bool circular_scroll_enable;
 } cirque_pinnacle_features_t;
 
 #if defined(CIRQUE_PINNACLE_TAP_ENABLE) && CIRQUE_PINNACLE_POSITION_MODE
-#    ifndef CIRQUE_PINNACLE_TAPPING_TERM
-#        include "action.h"
-#        include "action_tapping.h"
-#        define CIRQUE_PINNACLE_TAPPING_TERM GET_TAPPING_TERM(QK_MOUSE_BUTTON_1, &(keyrecord_t){})
-#    endif
-#    ifndef CIRQUE_PINNACLE_TOUCH_DEBOUNCE
-#        define CIRQUE_PINNACLE_TOUCH_DEBOUNCE (CIRQUE_PINNACLE_TAPPING_TERM * 8)
-#    endif
-
-typedef struct {
-    uint16_t timer;
-    bool     touchDown;
-} trackpad_tap_context_t;
+/* Tap is detected by the shared touch gesture engine, see pointing_device_touch.h */
 
 /* Enable/disable tap gesture */
 void cirque_pinnacle_enable_tap(bool enable);
@@ -94,7 +81,7 @@ void cirque_pinnacle_configure_circular_scroll(uint8_t outer_ring_pct, uint8_t t
 #endif
 
 #ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
-/* Implementation in pointing_device_drivers.c */
+/* Implementation in cirque_pinnacle.c */
 
 /* Enable/disable inertial cursor */
 void cirque_pinnacle_enable_cursor_glide(bool enable);
@@ -13,6 +13,7 @@
 #include "string.h"
 #include "wait.h"
 #include "spi_master.h"
+#include "sensor_transfer.h"
 #include "progmem.h"
 
 extern const uint8_t pmw33xx_firmware_signature[2] PROGMEM;
@@ -47,58 +48,39 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi) {
     }
 }
 
+static sensor_transfer_t pmw33xx_transfer(uint8_t sensor) {
+    return (sensor_transfer_t){
+        .cs_pin           = cs_pins[sensor],
+        .mode             = 3,
+        .divisor          = PMW33XX_SPI_DIVISOR,
+        .select_us        = 1,   // tNCS-SCLK, 10ns
+        .address_us       = 160, // tSRAD
+        .burst_address_us = 35,  // tSRAD_MOTBR
+        .read_hold_us     = 1,   // tSCLK-NCS for read operation, 120ns
+        .write_hold_us    = 35,  // tSCLK-NCS for write operation
+        .read_gap_us      = 19,  // tSRW/tSRR (=20us) minus tSCLK-NCS
+        .write_gap_us     = 145, // tSWW/tSWR (=180us) minus tSCLK-NCS
+    };
+}
+
 bool pmw33xx_spi_start(uint8_t sensor) {
-    if (!spi_start(cs_pins[sensor], false, 3, PMW33XX_SPI_DIVISOR)) {
-        spi_stop();
-        return false;
-    }
-    // tNCS-SCLK, 10ns
-    wait_us(1);
-    return true;
+    sensor_transfer_t transfer = pmw33xx_transfer(sensor);
+    return sensor_transfer_start(&transfer);
 }
 
 bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
-    if (!pmw33xx_spi_start(sensor)) {
-        return false;
-    }
-
     if (reg_addr != REG_Motion_Burst) {
         in_burst[sensor] = false;
     }
 
-    // send address of the register, with MSBit = 1 to indicate it's a write
-    uint8_t command[2] = {reg_addr | 0x80, data};
-    if (spi_transmit(command, sizeof(command)) != SPI_STATUS_SUCCESS) {
-        return false;
-    }
-
-    // tSCLK-NCS for write operation is 35us
-    wait_us(35);
-    spi_stop();
-
-    // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
-    // a safe lower bound
-    wait_us(145);
-    return true;
+    sensor_transfer_t transfer = pmw33xx_transfer(sensor);
+    return sensor_transfer_write(&transfer, reg_addr, data);
 }
 
 uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
-    if (!pmw33xx_spi_start(sensor)) {
-        return 0;
-    }
-
-    // send adress of the register, with MSBit = 0 to indicate it's a read
-    spi_write(reg_addr & 0x7f);
-    // tSRAD (=160us)
-    wait_us(160);
-    uint8_t data = spi_read();
-
-    // tSCLK-NCS, 120ns
-    wait_us(1);
-    spi_stop();
-
-    //  tSRW/tSRR (=20us) mins tSCLK-NCS
-    wait_us(19);
+    sensor_transfer_t transfer = pmw33xx_transfer(sensor);
+    uint8_t           data     = 0;
+    sensor_transfer_read(&transfer, reg_addr, &data, sizeof(data));
     return data;
 }
 
@@ -212,22 +194,18 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         in_burst[sensor] = true;
     }
 
-    if (!pmw33xx_spi_start(sensor)) {
-        return report;
+    // The whole burst is received in one transfer, using DMA where the platform supports it
+    sensor_transfer_t transfer = pmw33xx_transfer(sensor);
+    if (!sensor_transfer_read_burst(&transfer, REG_Motion_Burst, (uint8_t *)&report, sizeof(report))) {
+        in_burst[sensor] = false;
+        return (pmw33xx_report_t){0};
     }
 
-    spi_write(REG_Motion_Burst);
-    wait_us(35); // waits for tSRAD_MOTBR
-
-    spi_receive((uint8_t *)&report, sizeof(report));
-
     // panic recovery, sometimes burst mode works weird.
     if (report.motion.w & 0b111) {
         in_burst[sensor] = false;
     }
 
-    spi_stop();
-
     pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
 
     report.delta_x *= -1;
@@ -249,14 +227,28 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
-
-    if (report.motion.b.is_lifted) {
-        return mouse_report;
+    static bool in_motion = false;
+    bool        is_motion = false;
+    int32_t     delta_x   = 0;
+    int32_t     delta_y   = 0;
+
+#ifdef PMW33XX_MERGE_SENSORS
+    // Reading every sensor here lets them all be sampled in the background, rather than from pointing_device_task_kb()
+    const uint8_t number_of_sensors = pmw33xx_number_of_sensors;
+#else
+    const uint8_t number_of_sensors = 1;
+#endif
+    for (uint8_t sensor = 0; sensor < number_of_sensors; sensor++) {
+        pmw33xx_report_t report = pmw33xx_read_burst(sensor);
+        if (report.motion.b.is_lifted || !report.motion.b.is_motion) {
+            continue;
+        }
+        is_motion = true;
+        delta_x += report.delta_x;
+        delta_y += report.delta_y;
     }
 
-    if (!report.motion.b.is_motion) {
+    if (!is_motion) {
         in_motion = false;
         return mouse_report;
     }
@@ -266,7 +258,7 @@ report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
         pd_dprintf("PWM3360 (0): starting motion\n");
     }
 
-    mouse_report.x = CONSTRAIN_HID_XY(report.delta_x);
-    mouse_report.y = CONSTRAIN_HID_XY(report.delta_y);
+    mouse_report.x = CONSTRAIN_HID_XY(delta_x);
+    mouse_report.y = CONSTRAIN_HID_XY(delta_y);
     return mouse_report;
 }
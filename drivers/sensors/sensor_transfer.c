@@ -0,0 +1,86 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "sensor_transfer.h"
+#include "spi_master.h"
+#include "wait.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#endif
+
+void sensor_transfer_wait_us(uint16_t us) {
+    if (us == 0) {
+        return;
+    }
+#if defined(PROTOCOL_CHIBIOS)
+    if (us >= SENSOR_TRANSFER_SLEEP_THRESHOLD_US && chThdGetSelfX() != &(currcore->mainthread)) {
+        chThdSleepMicroseconds(us);
+        return;
+    }
+#endif
+    wait_us(us);
+}
+
+bool sensor_transfer_start(const sensor_transfer_t *sensor) {
+    if (!spi_start(sensor->cs_pin, false, sensor->mode, sensor->divisor)) {
+        spi_stop();
+        return false;
+    }
+    sensor_transfer_wait_us(sensor->select_us);
+    return true;
+}
+
+static bool sensor_transfer_read_common(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t address_us, uint8_t *data, uint16_t length) {
+    if (!sensor_transfer_start(sensor)) {
+        return false;
+    }
+
+    // MSBit = 0 to indicate a read
+    bool success = spi_write(reg_addr & 0x7f) >= 0;
+    if (success) {
+        sensor_transfer_wait_us(address_us);
+        success = spi_receive(data, length) == SPI_STATUS_SUCCESS;
+    }
+    if (!success) {
+        spi_stop();
+    }
+    return success;
+}
+
+bool sensor_transfer_read(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t *data, uint16_t length) {
+    bool success = sensor_transfer_read_common(sensor, reg_addr, sensor->address_us, data, length);
+    if (success) {
+        sensor_transfer_wait_us(sensor->read_hold_us);
+        spi_stop();
+        sensor_transfer_wait_us(sensor->read_gap_us);
+    }
+    return success;
+}
+
+bool sensor_transfer_read_burst(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t *data, uint16_t length) {
+    bool success = sensor_transfer_read_common(sensor, reg_addr, sensor->burst_address_us, data, length);
+    if (success) {
+        // Deselecting the sensor ends the burst, with no further delay needed
+        spi_stop();
+    }
+    return success;
+}
+
+bool sensor_transfer_write(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t value) {
+    if (!sensor_transfer_start(sensor)) {
+        return false;
+    }
+
+    // MSBit = 1 to indicate a write
+    uint8_t command[2] = {reg_addr | 0x80, value};
+    if (spi_transmit(command, sizeof(command)) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+
+    sensor_transfer_wait_us(sensor->write_hold_us);
+    spi_stop();
+    sensor_transfer_wait_us(sensor->write_gap_us);
+    return true;
+}
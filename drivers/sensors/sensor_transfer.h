@@ -0,0 +1,79 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+// Delays at least this long are slept through rather than spun, when not called from the keyboard loop
+#ifndef SENSOR_TRANSFER_SLEEP_THRESHOLD_US
+#    define SENSOR_TRANSFER_SLEEP_THRESHOLD_US 20
+#endif
+
+/**
+ * Bus settings and timings of an SPI motion sensor, as given in its datasheet. All delays are in microseconds.
+ */
+typedef struct sensor_transfer_t {
+    pin_t    cs_pin;
+    uint8_t  mode;
+    uint16_t divisor;
+    uint8_t  select_us;        // tNCS-SCLK: after selecting the sensor, before the first clock
+    uint8_t  address_us;       // tSRAD: after sending a register address, before reading its value
+    uint8_t  burst_address_us; // tSRAD_MOTBR: after sending the burst register address, before reading the burst
+    uint8_t  read_hold_us;     // tSCLK-NCS: after reading a register, before deselecting the sensor
+    uint8_t  write_hold_us;    // tSCLK-NCS: after writing a register, before deselecting the sensor
+    uint8_t  read_gap_us;      // tSRW/tSRR: after reading a register, before the next transaction
+    uint8_t  write_gap_us;     // tSWW/tSWR: after writing a register, before the next transaction
+} sensor_transfer_t;
+
+/**
+ * @brief Selects the sensor, ready for the first clock
+ *
+ * @param sensor sensor_transfer_t of the sensor
+ * @return true if the bus was started, false otherwise
+ */
+bool sensor_transfer_start(const sensor_transfer_t *sensor);
+
+/**
+ * @brief Reads registers from the sensor in a single transaction
+ *
+ * @param sensor sensor_transfer_t of the sensor
+ * @param reg_addr address of the first register
+ * @param data buffer to read into
+ * @param length number of bytes to read
+ * @return true if the read was a success, false otherwise
+ */
+bool sensor_transfer_read(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t *data, uint16_t length);
+
+/**
+ * @brief Reads a motion burst from the sensor, receiving the whole burst in a single transfer
+ *
+ * @param sensor sensor_transfer_t of the sensor
+ * @param reg_addr address of the burst register
+ * @param data buffer to read into
+ * @param length number of bytes to read
+ * @return true if the read was a success, false otherwise
+ */
+bool sensor_transfer_read_burst(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t *data, uint16_t length);
+
+/**
+ * @brief Writes a register on the sensor
+ *
+ * @param sensor sensor_transfer_t of the sensor
+ * @param reg_addr address of the register
+ * @param value value to write
+ * @return true if the write was a success, false otherwise
+ */
+bool sensor_transfer_write(const sensor_transfer_t *sensor, uint8_t reg_addr, uint8_t value);
+
+/**
+ * @brief Waits for a sensor timing to elapse
+ *
+ * On ChibiOS, threads other than the keyboard loop (such as background sampling) sleep through longer delays, rather
+ * than keeping the CPU from the keyboard loop.
+ *
+ * @param us delay in microseconds
+ */
+void sensor_transfer_wait_us(uint16_t us);
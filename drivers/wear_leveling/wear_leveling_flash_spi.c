@@ -2,19 +2,113 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #include <stdbool.h>
 #include <hal.h>
-#include "util.h"
-#include "timer.h"
 #include "wear_leveling.h"
 #include "wear_leveling_flash_spi_config.h"
 #include "wear_leveling_internal.h"
 
-#ifndef WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
-#    define WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT 32
-#endif // WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT
+/*
+    Writes are gathered into a page-sized buffer while the backing store is
+    unlocked, and are programmed to the flash in a single page-program
+    operation when the buffer fills, when a non-contiguous address is written,
+    when a read is requested, or when the backing store is locked again. As the
+    wear-leveling write log is append-only, each logical write generally
+    results in a single page-program operation instead of one per log entry.
+
+    Erases are performed sector-by-sector ahead of the write position -- an
+    erase only issues the first sector erase, and each subsequent backing store
+    operation issues the next sector erase once the flash is no longer busy.
+    backing_store_task() does the same while the keyboard is otherwise idle, but
+    is only invoked through wear_leveling_task() when the write cache is
+    enabled -- without it, erase-ahead only progresses with backing store
+    traffic.
+    Operations only wait for the sectors they touch. Only sectors written to
+    since the previous erase are erased; as this isn't known until after the
+    first erase, the entire backing store is erased the first time around.
+*/
+
+#define WEAR_LEVELING_EXTERNAL_FLASH_BASE ((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE))
+
+STATIC_ASSERT((WEAR_LEVELING_BACKING_SIZE) % (EXTERNAL_FLASH_SECTOR_SIZE) == 0, "Backing size must be a multiple of the flash sector size");
+STATIC_ASSERT((EXTERNAL_FLASH_PAGE_SIZE) % (BACKING_STORE_WRITE_SIZE) == 0, "Flash page size must be a multiple of the write size");
+
+static struct {
+    uint32_t address;                          // Backing store address of the first buffered byte
+    uint32_t length;                           // Number of buffered bytes
+    uint8_t  data[(EXTERNAL_FLASH_PAGE_SIZE)]; // Buffered data, already complemented
+} page_buffer;
+
+static uint32_t erase_next = (WEAR_LEVELING_BACKING_SIZE); // Backing store address of the next sector to be erased
+static uint32_t erase_end  = (WEAR_LEVELING_BACKING_SIZE); // Backing store address of the end of the erase range
+static uint32_t dirty_end  = (WEAR_LEVELING_BACKING_SIZE); // Backing store address of the end of the written range since the last erase
+
+/**
+ * Issues the next queued sector erase if the flash isn't busy, without waiting for it to complete.
+ */
+static bool erase_ahead_kick(void) {
+    if (erase_next >= erase_end || flash_is_busy() != FLASH_STATUS_SUCCESS) {
+        return true;
+    }
+
+    flash_status_t status = flash_begin_erase_sector(WEAR_LEVELING_EXTERNAL_FLASH_BASE + erase_next);
+    erase_next += (EXTERNAL_FLASH_SECTOR_SIZE);
+    return status == FLASH_STATUS_SUCCESS;
+}
+
+/**
+ * Ensures all sectors below the supplied backing store address have been erased.
+ */
+static bool erase_ahead_wait(uint32_t address) {
+    while (erase_next < erase_end && erase_next < address) {
+        if (flash_begin_erase_sector(WEAR_LEVELING_EXTERNAL_FLASH_BASE + erase_next) != FLASH_STATUS_SUCCESS) {
+            return false;
+        }
+        erase_next += (EXTERNAL_FLASH_SECTOR_SIZE);
+    }
+
+    // Any erase in progress needs to complete before the flash can be accessed
+    return flash_wait_erase_sector() == FLASH_STATUS_SUCCESS;
+}
+
+/**
+ * Programs any buffered data to the flash.
+ */
+static bool page_buffer_flush(void) {
+    if (page_buffer.length == 0) {
+        return true;
+    }
+
+    uint32_t address     = page_buffer.address;
+    uint32_t length      = page_buffer.length;
+    page_buffer.length   = 0;
+    uint32_t written_end = address + length;
+
+    // Also wait for the sector following the written data -- playback stops at the first empty slot, which must not be stale
+    if (!erase_ahead_wait(written_end + 1)) {
+        return false;
+    }
+
+    bs_dprintf("Write ");
+    wl_dump(WEAR_LEVELING_EXTERNAL_FLASH_BASE + address, page_buffer.data, length);
+    if (flash_write_range(WEAR_LEVELING_EXTERNAL_FLASH_BASE + address, page_buffer.data, length) != FLASH_STATUS_SUCCESS) {
+        return false;
+    }
+
+    if (dirty_end < written_end) {
+        dirty_end = written_end;
+    }
+
+    return erase_ahead_kick();
+}
 
 bool backing_store_init(void) {
     bs_dprintf("Init\n");
     flash_init();
+
+    // Unknown what's been written previously, so the whole backing store needs to be erased on the first erase
+    page_buffer.length = 0;
+    erase_next         = (WEAR_LEVELING_BACKING_SIZE);
+    erase_end          = (WEAR_LEVELING_BACKING_SIZE);
+    dirty_end          = (WEAR_LEVELING_BACKING_SIZE);
     return true;
 }
 
@@ -25,21 +119,22 @@ bool backing_store_unlock(void) {
 }
 
 bool backing_store_erase(void) {
-#ifdef WEAR_LEVELING_DEBUG_OUTPUT
-    uint32_t start = timer_read32();
-#endif
-
-    bool ret = true;
-    for (int i = 0; i < (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT); ++i) {
-        flash_status_t status = flash_erase_block(((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) + i) * (EXTERNAL_FLASH_BLOCK_SIZE));
-        if (status != FLASH_STATUS_SUCCESS) {
-            ret = false;
-            break;
-        }
+    // Any buffered data is about to be erased anyway
+    page_buffer.length = 0;
+
+    // Finish off any erase that was already queued, as it may overlap with the newly written range
+    if (!erase_ahead_wait(erase_end)) {
+        return false;
     }
 
-    bs_dprintf("Backing store erase took %ldms to complete\n", ((long)(timer_read32() - start)));
-    return ret;
+    // Only the sectors written since the last erase need to be erased
+    erase_next = 0;
+    erase_end  = ((dirty_end + (EXTERNAL_FLASH_SECTOR_SIZE)-1) / (EXTERNAL_FLASH_SECTOR_SIZE)) * (EXTERNAL_FLASH_SECTOR_SIZE);
+    dirty_end  = 0;
+    bs_dprintf("Erase queued for 0x%08lX bytes\n", (unsigned long)erase_end);
+
+    // Start the first sector erase, the remainder are issued by subsequent operations
+    return erase_ahead_kick();
 }
 
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
@@ -48,8 +143,13 @@ bool backing_store_write(uint32_t address, backing_store_int_t value) {
 
 bool backing_store_lock(void) {
     bs_dprintf("Lock  \n");
-    // No-op -- handled by the flash driver as it is.
-    return true;
+    // Write out anything left in the buffer, locking is done by the flash driver as it is.
+    return page_buffer_flush();
+}
+
+void backing_store_task(void) {
+    // Keep the queued erases moving even when nothing is reading or writing
+    erase_ahead_kick();
 }
 
 bool backing_store_read(uint32_t address, backing_store_int_t *value) {
@@ -57,8 +157,13 @@ bool backing_store_read(uint32_t address, backing_store_int_t *value) {
 }
 
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
+    // Make sure anything previously written or erased is reflected in the flash
+    if (!page_buffer_flush() || !erase_ahead_wait(address + sizeof(backing_store_int_t) * item_count)) {
+        return false;
+    }
+
     bs_dprintf("Read  ");
-    uint32_t       offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    uint32_t       offset = WEAR_LEVELING_EXTERNAL_FLASH_BASE + address;
     flash_status_t status = flash_read_range(offset, values, sizeof(backing_store_int_t) * item_count);
     if (status == FLASH_STATUS_SUCCESS) {
         for (size_t i = 0; i < item_count; ++i) {
@@ -70,33 +175,35 @@ bool backing_store_read_bulk(uint32_t address, backing_store_int_t *values, size
 }
 
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, size_t item_count) {
-    uint32_t            offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
-    size_t              index  = 0;
-    backing_store_int_t temp[WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT];
-    do {
-        // Copy out the block of data we want to transmit first
-        size_t this_loop = MIN(item_count, WEAR_LEVELING_EXTERNAL_FLASH_BULK_COUNT);
-        for (size_t i = 0; i < this_loop; ++i) {
-            temp[i] = values[index + i];
+    for (size_t i = 0; i < item_count; ++i) {
+        // Flush if this write isn't contiguous with the buffered data, or would cross into the next page
+        if (page_buffer.length > 0) {
+            bool contiguous = (page_buffer.address + page_buffer.length) == address;
+            bool same_page  = (page_buffer.address / (EXTERNAL_FLASH_PAGE_SIZE)) == (address / (EXTERNAL_FLASH_PAGE_SIZE));
+            if (!contiguous || !same_page) {
+                if (!page_buffer_flush()) {
+                    return false;
+                }
+            }
         }
 
-        bs_dprintf("Write ");
-        wl_dump(offset, temp, sizeof(backing_store_int_t) * this_loop);
-
-        // Take the complement instead
-        for (size_t i = 0; i < this_loop; ++i) {
-            temp[i] = ~temp[i];
+        if (page_buffer.length == 0) {
+            page_buffer.address = address;
         }
 
-        // Write out the block
-        if (flash_write_range(offset, temp, sizeof(backing_store_int_t) * this_loop) != FLASH_STATUS_SUCCESS) {
-            return false;
+        // Take the complement instead
+        backing_store_int_t value = ~values[i];
+        memcpy(&page_buffer.data[page_buffer.length], &value, sizeof(backing_store_int_t));
+        page_buffer.length += sizeof(backing_store_int_t);
+        address += sizeof(backing_store_int_t);
+
+        // Program the page as soon as it's full
+        if ((address % (EXTERNAL_FLASH_PAGE_SIZE)) == 0) {
+            if (!page_buffer_flush()) {
+                return false;
+            }
         }
-
-        offset += this_loop * sizeof(backing_store_int_t);
-        index += this_loop;
-        item_count -= this_loop;
-    } while (item_count > 0);
+    }
 
     return true;
 }
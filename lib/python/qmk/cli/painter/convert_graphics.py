@@ -12,6 +12,7 @@ from PIL import Image
 @cli.argument('-o', '--output', default='', help='Specify output directory. Defaults to same directory as input.')
 @cli.argument('-f', '--format', required=True, help=f'Output format, valid types: {", ".join(valid_formats.keys())}')
 @cli.argument('-r', '--no-rle', arg_only=True, action='store_true', help='Disables the use of RLE when encoding images.')
+@cli.argument('-z', '--lz', arg_only=True, action='store_true', help='Enables the use of LZ when encoding images, requires QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION.')
 @cli.argument('-d', '--no-deltas', arg_only=True, action='store_true', help='Disables the use of delta frames when encoding animations.')
 @cli.argument('-w', '--raw', arg_only=True, action='store_true', help='Writes out the QGF file as raw data instead of c/h combo.')
 @cli.subcommand('Converts an input image to something QMK understands')
@@ -50,9 +51,17 @@ def painter_convert_graphics(cli):
     # Convert the image to QGF using PIL
     out_data = BytesIO()
     metadata = []
-    input_img.save(out_data, "QGF", use_deltas=(not cli.args.no_deltas), use_rle=(not cli.args.no_rle), qmk_format=format, verbose=cli.args.verbose, metadata=metadata)
+    input_img.save(out_data, "QGF", use_deltas=(not cli.args.no_deltas), use_rle=(not cli.args.no_rle), use_lz=cli.args.lz, qmk_format=format, verbose=cli.args.verbose, metadata=metadata)
     out_bytes = out_data.getvalue()
 
+    # Report how well the pixel data compressed, and how long it takes to decode on the host
+    frames = metadata[1:]
+    raw_size = sum(f["raw_size"] for f in frames)
+    data_size = sum(f["data_size"] for f in frames)
+    decode_time = sum(f["decode_time"] for f in frames)
+    if raw_size:
+        cli.log.info(f"{cli.args.input.name}: pixel data {data_size}/{raw_size} bytes ({100*data_size/raw_size:.2f}%), host decode {1000*decode_time:.2f}ms")
+
     if cli.args.raw:
         raw_file = cli.args.output / f"{cli.args.input.stem}.qgf"
         with open(raw_file, 'wb') as raw:
@@ -0,0 +1,113 @@
+"""Packs Quantum Painter assets into an image for external flash.
+"""
+import datetime
+import re
+import struct
+from string import Template
+
+from qmk.path import normpath
+from milc import cli
+
+# Index at the start of the flash image: magic, version, asset count, then an (offset, length) pair per asset
+INDEX_MAGIC = b'QPAK'
+INDEX_VERSION = 1
+INDEX_HEADER_FORMAT = '<4sHH'
+INDEX_ENTRY_FORMAT = '<II'
+
+# Expected typeid of the first block of each asset, alongside its magic
+ASSET_MAGICS = {b'QGF': 'image', b'QFF': 'font'}
+
+header_file_template = """\
+// Copyright ${year} QMK -- generated source code only, packed assets retain original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-pack-flash`, for a flash image written at ${base_address}.
+// Load each asset using qp_load_image_flash() or qp_load_font_flash() with the corresponding address.
+
+#pragma once
+
+${defines}
+"""
+
+
+def _validate_asset(path, data):
+    """Checks the asset is a QGF/QFF file, returning its type.
+    """
+    if len(data) < 17 or data[0] != 0x00 or data[1] != 0xFF or bytes(data[5:8]) not in ASSET_MAGICS:
+        raise ValueError(f'{path.name} is not a QGF or QFF file, convert it with --raw first')
+    total_size, = struct.unpack_from('<I', data, 9)
+    if total_size != len(data):
+        raise ValueError(f'{path.name} has a mismatched size ({total_size} declared, {len(data)} actual)')
+    return ASSET_MAGICS[bytes(data[5:8])]
+
+
+def _align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+@cli.argument('-i', '--input', required=True, arg_only=True, action='append', help='Specify input QGF/QFF file. May be passed multiple times.')
+@cli.argument('-o', '--output', required=True, help='Specify output flash image file. The matching header is written alongside it.')
+@cli.argument('-b', '--base-address', default='0', help='Address of the flash image within external flash. Default 0.')
+@cli.argument('-a', '--align', default='4', help='Alignment of each asset within the flash image. Default 4.')
+@cli.subcommand('Packs converted images and fonts into an image for external flash')
+def painter_pack_flash(cli):
+    """Packs raw QGF/QFF files into a single image for external flash.
+
+    The image starts with an index of the packed assets, and a header listing the address of each asset is written next to the output -- `OUTPUT.h`.
+    """
+    base_address = int(cli.args.base_address, 0)
+    alignment = int(cli.args.align, 0)
+    if alignment < 1:
+        cli.log.error('Alignment must be at least 1!')
+        return False
+
+    # Load and validate the inputs
+    assets = []
+    for input_file in cli.args.input:
+        path = normpath(input_file)
+        if not path.exists():
+            cli.log.error(f'Input file {path} does not exist!')
+            return False
+        data = path.read_bytes()
+        try:
+            asset_type = _validate_asset(path, data)
+        except ValueError as e:
+            cli.log.error(str(e))
+            return False
+        assets.append((path, asset_type, data))
+
+    # Lay out the index, followed by each asset
+    index_size = struct.calcsize(INDEX_HEADER_FORMAT) + struct.calcsize(INDEX_ENTRY_FORMAT) * len(assets)
+    image = bytearray(struct.pack(INDEX_HEADER_FORMAT, INDEX_MAGIC, INDEX_VERSION, len(assets)))
+    offset = _align(index_size, alignment)
+    layout = []
+    for path, asset_type, data in assets:
+        image += struct.pack(INDEX_ENTRY_FORMAT, offset, len(data))
+        layout.append((path, asset_type, offset, data))
+        offset = _align(offset + len(data), alignment)
+
+    # Pad with erased flash between the assets
+    for path, asset_type, asset_offset, data in layout:
+        image += b'\xFF' * (asset_offset - len(image))
+        image += data
+
+    output_file = normpath(cli.args.output)
+    output_file.parent.mkdir(parents=True, exist_ok=True)
+    print(f"Writing {output_file}...")
+    output_file.write_bytes(image)
+
+    # Render the header with the address of each asset
+    defines = []
+    for path, asset_type, asset_offset, data in layout:
+        sane_name = re.sub(r'[^a-zA-Z0-9]', '_', path.stem).upper()
+        defines.append(f'#define QP_FLASH_{asset_type.upper()}_{sane_name}_ADDRESS 0x{base_address + asset_offset:08X}')
+        defines.append(f'#define QP_FLASH_{asset_type.upper()}_{sane_name}_LENGTH {len(data)}')
+
+    header_file = output_file.with_suffix('.h')
+    header_text = Template(header_file_template).substitute({
+        'year': datetime.date.today().strftime('%Y'),
+        'base_address': f'0x{base_address:08X}',
+        'defines': '\n'.join(defines),
+    })
+    print(f"Writing {header_file}...")
+    header_file.write_text(header_text)
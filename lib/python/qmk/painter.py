@@ -3,6 +3,7 @@
 import datetime
 import math
 import re
+from collections import deque
 from pathlib import Path
 from string import Template
 from PIL import Image, ImageOps
@@ -105,6 +106,11 @@ def _render_image_metadata(metadata):
         f"// Height: {size['height']}",
     ]
 
+    raw_size = sum(v["raw_size"] for v in metadata)
+    data_size = sum(v["data_size"] for v in metadata)
+    if raw_size:
+        lines.append(f"// Pixel data: {data_size}/{raw_size} bytes ({100*data_size/raw_size:.2f}%)")
+
     if len(metadata) == 1:
         lines.append("// Single frame")
 
@@ -454,3 +460,123 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def decompress_bytes_qmk_rle(data, expected_length):
+    """Decodes QMK RLE data, mirroring the firmware's decoder.
+    """
+    output = []
+    n = 0
+    while len(output) < expected_length:
+        marker = data[n]
+        n += 1
+        if marker >= 128:
+            length = marker - 127
+            output.extend(data[n:n + length])
+            n += length
+        else:
+            output.extend([data[n]] * marker)
+            n += 1
+    return output[:expected_length]
+
+
+# QMK LZ parameters, must match qp_draw.h
+QMK_LZ_WINDOW_SIZE = 256
+QMK_LZ_MIN_MATCH = 4
+
+
+def compress_bytes_qmk_lz(data):
+    """Encodes data using QMK LZ -- LZ4-style sequences of literals followed by a match, with a 256-byte window.
+    """
+    data = bytes(data)
+    output = bytearray()
+    candidates = {}
+    literal_start = 0
+
+    def append_length(length):
+        while length >= 255:
+            output.append(255)
+            length -= 255
+        output.append(length)
+
+    def append_sequence(literals, distance=None, length=None):
+        match_len = 0 if distance is None else length - QMK_LZ_MIN_MATCH
+        output.append((min(len(literals), 15) << 4) | min(match_len, 15))
+        if len(literals) >= 15:
+            append_length(len(literals) - 15)
+        output.extend(literals)
+        if distance is not None:
+            output.append(distance - 1)
+            if match_len >= 15:
+                append_length(match_len - 15)
+
+    def remember(pos):
+        positions = candidates.setdefault(data[pos:pos + QMK_LZ_MIN_MATCH], deque())
+        positions.append(pos)
+        while positions[0] < pos - QMK_LZ_WINDOW_SIZE:
+            positions.popleft()
+
+    n = 0
+    while n + QMK_LZ_MIN_MATCH <= len(data):
+        # Find the longest match within the window, preferring the closest
+        best_len, best_distance = 0, 0
+        for pos in reversed(candidates.get(data[n:n + QMK_LZ_MIN_MATCH], ())):
+            if n - pos > QMK_LZ_WINDOW_SIZE:
+                break
+            length = QMK_LZ_MIN_MATCH
+            while n + length < len(data) and data[pos + length] == data[n + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_distance = length, n - pos
+
+        if best_len == 0:
+            remember(n)
+            n += 1
+            continue
+
+        append_sequence(data[literal_start:n], best_distance, best_len)
+        for pos in range(n, min(n + best_len, len(data) - QMK_LZ_MIN_MATCH + 1)):
+            remember(pos)
+        n += best_len
+        literal_start = n
+
+    # Trailing literals, the decoder stops before reading a match for the final sequence
+    if literal_start < len(data):
+        append_sequence(data[literal_start:])
+    return list(output)
+
+
+def decompress_bytes_qmk_lz(data, expected_length):
+    """Decodes QMK LZ data, mirroring the firmware's decoder.
+    """
+    output = []
+    n = 0
+
+    def read_length(length):
+        nonlocal n
+        while True:
+            c = data[n]
+            n += 1
+            length += c
+            if c != 255:
+                return length
+
+    while len(output) < expected_length:
+        token = data[n]
+        n += 1
+        literals = token >> 4
+        if literals == 15:
+            literals = read_length(literals)
+        output.extend(data[n:n + literals])
+        n += literals
+        if len(output) >= expected_length:
+            break
+
+        distance = data[n] + 1
+        n += 1
+        length = token & 0x0F
+        if length == 15:
+            length = read_length(length)
+        for _ in range(length + QMK_LZ_MIN_MATCH):
+            output.append(output[-distance])
+    return output
@@ -46,6 +46,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "ps2.h"
 #include "ps2_io.h"
 #include "print.h"
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+#    include "ps2_mouse.h"
+#endif
 
 #ifndef PS2_CLOCK_DDR
 #    define PS2_CLOCK_DDR PORTx_ADDRESS(PS2_CLOCK_PIN)
@@ -167,6 +170,9 @@ ISR(PS2_USART_RX_VECT) {
     // TODO: request RESEND when error occurs?
     uint8_t error = PS2_USART_ERROR; // USART error should be read before data
     uint8_t data  = PS2_USART_RX_DATA;
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    if (ps2_mouse_packet_receive(data, !error)) return;
+#endif
     if (!error) {
         pbuf_enqueue(data);
     } else {
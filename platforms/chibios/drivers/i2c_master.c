@@ -107,24 +107,40 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+/**
+ * @brief Takes ownership of the I2C bus, so that transactions issued from
+ * other threads (e.g. background pointing device sampling) are not
+ * interleaved, and starts the I2C peripheral.
+ */
+static void i2c_prologue(void) {
+#if I2C_USE_MUTUAL_EXCLUSION
+    i2cAcquireBus(&I2C_DRIVER);
+#endif
+    i2cStart(&I2C_DRIVER, &i2cconfig);
+}
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
- * aborting any ongoing transactions. Furthermore ChibiOS status codes are
- * converted into QMK codes.
+ * aborting any ongoing transactions, then releases the I2C bus. Furthermore
+ * ChibiOS status codes are converted into QMK codes.
  *
  * @param status ChibiOS specific I2C status code
  * @return i2c_status_t QMK specific I2C status code
  */
 static i2c_status_t i2c_epilogue(const msg_t status) {
+    if (status != MSG_OK) {
+        // From ChibiOS HAL: "After a timeout the driver must be stopped and
+        // restarted because the bus is in an uncertain state." We also issue that
+        // hard stop in case of any error.
+        i2cStop(&I2C_DRIVER);
+    }
+#if I2C_USE_MUTUAL_EXCLUSION
+    i2cReleaseBus(&I2C_DRIVER);
+#endif
+
     if (status == MSG_OK) {
         return I2C_STATUS_SUCCESS;
     }
-
-    // From ChibiOS HAL: "After a timeout the driver must be stopped and
-    // restarted because the bus is in an uncertain state." We also issue that
-    // hard stop in case of any error.
-    i2cStop(&I2C_DRIVER);
-
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
@@ -149,19 +165,19 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
 
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
@@ -174,7 +190,7 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
 
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
@@ -188,13 +204,13 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_prologue();
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
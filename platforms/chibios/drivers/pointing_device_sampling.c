@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+
+#    ifndef POINTING_DEVICE_SAMPLING_STACK_SIZE
+#        define POINTING_DEVICE_SAMPLING_STACK_SIZE 512
+#    endif
+
+// Runs above the keyboard loop's priority, so sensor reads are only delayed while another thread holds the sensor's bus
+#    ifndef POINTING_DEVICE_SAMPLING_PRIORITY
+#        define POINTING_DEVICE_SAMPLING_PRIORITY (NORMALPRIO + 1)
+#    endif
+
+static THD_WORKING_AREA(pointing_device_sampling_wa, POINTING_DEVICE_SAMPLING_STACK_SIZE);
+static THD_FUNCTION(pointing_device_sampling_thread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing");
+
+    // Sleeping until the next deadline rather than for a fixed time keeps the rate steady however long each read takes
+    systime_t deadline = chVTGetSystemTime();
+    while (true) {
+        pointing_device_sample();
+        deadline = chThdSleepUntilWindowed(deadline, chTimeAddX(deadline, TIME_US2I(POINTING_DEVICE_SAMPLING_INTERVAL_US)));
+    }
+}
+
+void pointing_device_sampling_init(void) {
+    static bool is_initialised = false;
+    if (!is_initialised) {
+        is_initialised = true;
+        chThdCreateStatic(pointing_device_sampling_wa, sizeof(pointing_device_sampling_wa), POINTING_DEVICE_SAMPLING_PRIORITY, pointing_device_sampling_thread, NULL);
+    }
+}
+
+#endif // POINTING_DEVICE_BACKGROUND_SAMPLING
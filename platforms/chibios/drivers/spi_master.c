@@ -455,6 +455,29 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    if (!spiStarted || SPI_DRIVER.state != SPI_READY) {
+        return SPI_STATUS_ERROR;
+    }
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_wait(void) {
+#if (SPI_USE_WAIT == TRUE)
+    // Same as the driver's own synchronous wait -- the end-of-transfer ISR resumes the waiting thread
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+    osalSysUnlock();
+#else
+    while (SPI_DRIVER.state == SPI_ACTIVE) {
+    }
+#endif // (SPI_USE_WAIT == TRUE)
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -24,3 +24,24 @@ void split_shared_memory_unlock(void) {
     chMtxUnlock(&SPLIT_SHARED_MEMORY_MUTEX);
 }
 #endif
+
+#if defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
+static MUTEX_DECL(POINTING_DEVICE_DRIVER_MUTEX);
+
+/**
+ * @brief Acquire exclusive access to the pointing device driver, by locking
+ * the mutex guarding it. Held by the sampling thread for each sensor read, and
+ * by the keyboard loop for any other driver call, as drivers perform multi-step
+ * bus sequences and keep state between them.
+ */
+void pointing_device_driver_lock(void) {
+    chMtxLock(&POINTING_DEVICE_DRIVER_MUTEX);
+}
+
+/**
+ * @brief Release the pointing device driver mutex that has been acquired before.
+ */
+void pointing_device_driver_unlock(void) {
+    chMtxUnlock(&POINTING_DEVICE_DRIVER_MUTEX);
+}
+#endif
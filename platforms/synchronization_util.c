@@ -10,8 +10,35 @@
 extern inline void split_shared_memory_lock(void);
 extern inline void split_shared_memory_unlock(void);
 #    endif
+#    if defined(POINTING_DEVICE_BACKGROUND_SAMPLING) && !defined(__AVR__)
+extern inline void pointing_device_driver_lock(void);
+extern inline void pointing_device_driver_unlock(void);
+#    endif
+#endif
+
+#if !defined(PLATFORM_SUPPORTS_SYNCHRONIZATION) && defined(POINTING_DEVICE_BACKGROUND_SAMPLING) && defined(__AVR__)
+#    include <avr/io.h>
+#    include <avr/interrupt.h>
+
+// Without threads the sensor is sampled from an interrupt, so the driver is guarded by masking interrupts. The previous
+// state is restored on unlock, so locking from the sampling interrupt itself leaves them masked.
+static uint8_t pointing_device_driver_sreg;
+
+void pointing_device_driver_lock(void) {
+    uint8_t sreg = SREG;
+    cli();
+    pointing_device_driver_sreg = sreg;
+}
+
+void pointing_device_driver_unlock(void) {
+    SREG = pointing_device_driver_sreg;
+}
 #endif
 
 #if defined(SPLIT_KEYBOARD)
 QMK_IMPLEMENT_AUTOUNLOCK_HELPERS(split_shared_memory)
 #endif
+
+#if defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
+QMK_IMPLEMENT_AUTOUNLOCK_HELPERS(pointing_device_driver)
+#endif
@@ -8,11 +8,24 @@
 void split_shared_memory_lock(void);
 void split_shared_memory_unlock(void);
 #    endif
+#    if defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
+void pointing_device_driver_lock(void);
+void pointing_device_driver_unlock(void);
+#    endif
 #else
 #    if defined(SPLIT_KEYBOARD)
 inline void split_shared_memory_lock(void){};
 inline void split_shared_memory_unlock(void){};
 #    endif
+#    if defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
+#        if defined(__AVR__)
+void pointing_device_driver_lock(void);
+void pointing_device_driver_unlock(void);
+#        else
+inline void pointing_device_driver_lock(void){};
+inline void pointing_device_driver_unlock(void){};
+#        endif
+#    endif
 #endif
 
 /* GCCs cleanup attribute expects a function with one parameter, which is a
@@ -52,3 +65,16 @@ QMK_DECLARE_AUTOUNLOCK_HELPERS(split_shared_memory)
  */
 #    define split_shared_memory_lock_autounlock QMK_DECLARE_AUTOUNLOCK_CALL(split_shared_memory)
 #endif
+
+#if defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
+QMK_DECLARE_AUTOUNLOCK_HELPERS(pointing_device_driver)
+
+/**
+ * @brief Acquire exclusive access to the pointing device driver, by calling
+ * the platforms `pointing_device_driver_lock()` function. The lock is
+ * automatically released by calling the platforms
+ * `pointing_device_driver_unlock()` function when the enclosing block goes out
+ * of scope.
+ */
+#    define pointing_device_driver_lock_autounlock QMK_DECLARE_AUTOUNLOCK_CALL(pointing_device_driver)
+#endif
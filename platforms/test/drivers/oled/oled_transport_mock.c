@@ -0,0 +1,127 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+#include <stdbool.h>
+#include "spi_master.h"
+#include "oled_driver.h"
+#include "oled_transport_mock.h"
+
+static uint8_t                     mock_log[OLED_TRANSPORT_MOCK_LOG_SIZE];
+static size_t                      mock_log_length = 0;
+static oled_transport_mock_stats_t mock_stats      = {0};
+
+// State of the emulated SPI bus
+static bool     dc_level      = false;
+static bool     bus_active    = false;
+static uint32_t start_count   = 0;
+static uint32_t fail_at_start = 0;
+
+// Outstanding asynchronous transfer, with a snapshot of the data when it was started
+static const uint8_t *async_data = NULL;
+static uint16_t       async_size = 0;
+static uint8_t        async_snapshot[OLED_TRANSPORT_MOCK_LOG_SIZE];
+
+static void mock_record(const uint8_t *data, uint16_t size) {
+    if (!bus_active || async_data) {
+        mock_stats.order_errors++;
+    }
+    if (mock_log_length + 3 + size > sizeof(mock_log)) {
+        return;
+    }
+    mock_log[mock_log_length++] = dc_level ? 0x40 : 0x00; // I2C_DATA : I2C_CMD
+    mock_log[mock_log_length++] = (uint8_t)size;
+    mock_log[mock_log_length++] = (uint8_t)(size >> 8);
+    memcpy(&mock_log[mock_log_length], data, size);
+    mock_log_length += size;
+    mock_stats.transfers++;
+}
+
+void oled_transport_mock_reset(void) {
+    mock_log_length = 0;
+    start_count     = 0;
+    fail_at_start   = 0;
+    memset(&mock_stats, 0, sizeof(mock_stats));
+}
+
+void oled_transport_mock_fail_start(uint32_t n) {
+    start_count   = 0;
+    fail_at_start = n;
+}
+
+size_t oled_transport_mock_get_log(const uint8_t **log) {
+    *log = mock_log;
+    return mock_log_length;
+}
+
+void oled_transport_mock_get_stats(oled_transport_mock_stats_t *stats) {
+    *stats             = mock_stats;
+    stats->bus_active  = bus_active;
+    stats->async_ended = async_data == NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// GPIO
+
+void mock_write_pin(pin_t pin, bool level) {
+    if (pin == OLED_DC_PIN) {
+        dc_level = level;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SPI master
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (bus_active) {
+        // The bus is still held by a previous transaction
+        mock_stats.order_errors++;
+        return false;
+    }
+    if (fail_at_start && ++start_count == fail_at_start) {
+        return false;
+    }
+    bus_active = true;
+    return true;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    mock_record(data, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    if (!bus_active || async_data) {
+        mock_stats.order_errors++;
+    }
+    if (length > sizeof(async_snapshot)) {
+        return SPI_STATUS_ERROR;
+    }
+    memcpy(async_snapshot, data, length);
+    async_data = data;
+    async_size = length;
+    mock_stats.async_count++;
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_wait(void) {
+    if (async_data) {
+        // Behaves like DMA -- the data is only read now, so any modification made in the meantime is sent
+        const uint8_t *data = async_data;
+        async_data          = NULL;
+        if (memcmp(async_snapshot, data, async_size) != 0) {
+            mock_stats.async_modified++;
+        }
+        mock_record(data, async_size);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    if (async_data) {
+        // Deselecting the display mid-transfer
+        mock_stats.order_errors++;
+    }
+    bus_active = false;
+}
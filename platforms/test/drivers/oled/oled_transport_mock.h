@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OLED transport mock
+//
+// Provides the SPI master API used by the OLED driver, recording every transfer for host-side testing. Asynchronous
+// transfers behave like a DMA engine would -- the data is only read once the transfer is waited upon, so any
+// modification made while the transfer is outstanding shows up in the recorded output.
+
+#ifndef OLED_TRANSPORT_MOCK_LOG_SIZE
+#    define OLED_TRANSPORT_MOCK_LOG_SIZE 8192
+#endif
+
+typedef struct oled_transport_mock_stats_t {
+    uint32_t transfers;      // Number of transfers completed, including asynchronous ones
+    uint32_t async_count;    // Number of asynchronous transfers started
+    uint32_t async_modified; // Number of asynchronous transfers whose data was modified before the transfer completed
+    uint32_t order_errors;   // Number of transfers or bus operations issued while the bus was in the wrong state
+    bool     bus_active;     // Whether the bus is currently held by a transaction
+    bool     async_ended;    // Whether every asynchronous transfer has been waited upon
+} oled_transport_mock_stats_t;
+
+// Clears the recorded transfers and statistics
+void oled_transport_mock_reset(void);
+
+// Makes the nth subsequent spi_start() fail, as if the bus were in use by another device -- 0 disables
+void oled_transport_mock_fail_start(uint32_t n);
+
+// Retrieves the recorded transfers -- each is logged as the equivalent I2C control byte (I2C_CMD or I2C_DATA, from the
+// D/C pin), its payload length as two little-endian bytes, then the payload itself
+size_t oled_transport_mock_get_log(const uint8_t **log);
+
+void oled_transport_mock_get_stats(oled_transport_mock_stats_t *stats);
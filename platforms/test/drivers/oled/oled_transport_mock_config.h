@@ -0,0 +1,20 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The test platform has no GPIO, so the D/C and CS pins are routed to the OLED transport mock
+
+typedef uint8_t pin_t;
+
+#define OLED_TRANSPORT_SPI
+#define OLED_DC_PIN 1
+#define OLED_CS_PIN 2
+
+#define gpio_set_pin_output(pin) ((void)(pin))
+#define gpio_write_pin_high(pin) (mock_write_pin(pin, true))
+#define gpio_write_pin_low(pin) (mock_write_pin(pin, false))
+
+void mock_write_pin(pin_t pin, bool level);
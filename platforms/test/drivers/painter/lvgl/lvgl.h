@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LVGL stand-in
+//
+// A minimal stand-in for the LVGL v8.2 display driver API used by the Quantum Painter integration, so that qp_lvgl.c
+// can be exercised on the host. Only the display refresh is modelled -- lv_task_handler() renders each invalidated area
+// in parts no larger than the draw buffer, and hands them to the flush callback following the buffer handling of
+// LVGL's lv_refr.c:
+//
+//  - with one buffer, rendering waits until the previous flush has completed
+//  - with two buffers, rendering goes to the buffer not being flushed, and the flush of each part waits until the
+//    previous flush has completed
+//
+// Waiting spins on the draw buffer's `flushing` flag, calling the driver's wait_cb each time, as LVGL does.
+
+typedef int16_t  lv_coord_t;
+typedef uint16_t lv_color_t; // LV_COLOR_DEPTH 16, with LV_COLOR_16_SWAP
+
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t y1;
+    lv_coord_t x2;
+    lv_coord_t y2;
+} lv_area_t;
+
+typedef struct _lv_disp_draw_buf_t {
+    void        *buf1;
+    void        *buf2;
+    void        *buf_act;
+    uint32_t     size; // in pixels
+    volatile int flushing;
+    volatile int flushing_last;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t {
+    lv_coord_t          hor_res;
+    lv_coord_t          ver_res;
+    lv_disp_draw_buf_t *draw_buf;
+    void (*flush_cb)(struct _lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+    void (*wait_cb)(struct _lv_disp_drv_t *disp_drv);
+} lv_disp_drv_t;
+
+typedef struct _lv_disp_t {
+    lv_disp_drv_t *driver;
+} lv_disp_t;
+
+void       lv_init(void);
+void       lv_tick_inc(uint32_t tick_period);
+uint32_t   lv_task_handler(void);
+void       lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt);
+void       lv_disp_drv_init(lv_disp_drv_t *driver);
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver);
+void       lv_disp_flush_ready(lv_disp_drv_t *disp_drv);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Test controls
+
+// Marks an area to be filled with a colour on the next lv_task_handler()
+void lv_stub_invalidate(const lv_area_t *area, lv_color_t color);
+
+// Number of times the flush callback has been invoked since the display was registered
+uint32_t lv_stub_flush_count(void);
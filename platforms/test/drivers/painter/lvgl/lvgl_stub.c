@@ -0,0 +1,111 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "lvgl.h"
+
+#define LV_STUB_MAX_AREAS 8
+
+static lv_disp_t  disp;
+static lv_area_t  inv_areas[LV_STUB_MAX_AREAS];
+static lv_color_t inv_colors[LV_STUB_MAX_AREAS];
+static uint8_t    inv_count   = 0;
+static uint32_t   flush_count = 0;
+
+void lv_init(void) {
+    inv_count = 0;
+}
+
+void lv_tick_inc(uint32_t tick_period) {}
+
+void lv_disp_draw_buf_init(lv_disp_draw_buf_t *draw_buf, void *buf1, void *buf2, uint32_t size_in_px_cnt) {
+    memset(draw_buf, 0, sizeof(lv_disp_draw_buf_t));
+    draw_buf->buf1    = buf1;
+    draw_buf->buf2    = buf2;
+    draw_buf->buf_act = buf1;
+    draw_buf->size    = size_in_px_cnt;
+}
+
+void lv_disp_drv_init(lv_disp_drv_t *driver) {
+    memset(driver, 0, sizeof(lv_disp_drv_t));
+}
+
+lv_disp_t *lv_disp_drv_register(lv_disp_drv_t *driver) {
+    disp.driver = driver;
+    flush_count = 0;
+    return &disp;
+}
+
+void lv_disp_flush_ready(lv_disp_drv_t *disp_drv) {
+    disp_drv->draw_buf->flushing      = 0;
+    disp_drv->draw_buf->flushing_last = 0;
+}
+
+void lv_stub_invalidate(const lv_area_t *area, lv_color_t color) {
+    if (inv_count < LV_STUB_MAX_AREAS) {
+        inv_areas[inv_count]  = *area;
+        inv_colors[inv_count] = color;
+        inv_count++;
+    }
+}
+
+uint32_t lv_stub_flush_count(void) {
+    return flush_count;
+}
+
+static void lv_stub_wait_flush(lv_disp_drv_t *driver) {
+    while (driver->draw_buf->flushing) {
+        if (driver->wait_cb) {
+            driver->wait_cb(driver);
+        }
+    }
+}
+
+// Mirrors draw_buf_flush() -- waits for the previous flush, flushes the rendered part, then swaps buffers
+static void lv_stub_flush_part(lv_disp_drv_t *driver, const lv_area_t *area, bool last) {
+    lv_disp_draw_buf_t *draw_buf = driver->draw_buf;
+    lv_stub_wait_flush(driver);
+
+    draw_buf->flushing      = 1;
+    draw_buf->flushing_last = last;
+    flush_count++;
+    driver->flush_cb(driver, area, (lv_color_t *)draw_buf->buf_act);
+
+    if (draw_buf->buf1 && draw_buf->buf2) {
+        draw_buf->buf_act = (draw_buf->buf_act == draw_buf->buf1) ? draw_buf->buf2 : draw_buf->buf1;
+    }
+}
+
+// Mirrors lv_refr_area() -- renders the area in parts of as many rows as fit in the draw buffer
+static void lv_stub_refr_area(lv_disp_drv_t *driver, const lv_area_t *area, lv_color_t color, bool last_area) {
+    lv_disp_draw_buf_t *draw_buf = driver->draw_buf;
+    lv_coord_t          w        = area->x2 - area->x1 + 1;
+    lv_coord_t          max_rows = (lv_coord_t)(draw_buf->size / w);
+    for (lv_coord_t y = area->y1; y <= area->y2; y += max_rows) {
+        lv_area_t part = {.x1 = area->x1, .y1 = y, .x2 = area->x2, .y2 = y + max_rows - 1};
+        if (part.y2 > area->y2) {
+            part.y2 = area->y2;
+        }
+
+        // In single buffered mode, wait here until the buffer is freed
+        if (draw_buf->buf1 && !draw_buf->buf2) {
+            lv_stub_wait_flush(driver);
+        }
+
+        lv_color_t *buf   = (lv_color_t *)draw_buf->buf_act;
+        uint32_t    count = (uint32_t)w * (part.y2 - part.y1 + 1);
+        for (uint32_t i = 0; i < count; ++i) {
+            buf[i] = color;
+        }
+
+        lv_stub_flush_part(driver, &part, last_area && part.y2 == area->y2);
+    }
+}
+
+uint32_t lv_task_handler(void) {
+    if (disp.driver && disp.driver->flush_cb) {
+        for (uint8_t i = 0; i < inv_count; ++i) {
+            lv_stub_refr_area(disp.driver, &inv_areas[i], inv_colors[i], i == inv_count - 1);
+        }
+    }
+    inv_count = 0;
+    return 30;
+}
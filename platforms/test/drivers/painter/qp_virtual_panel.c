@@ -0,0 +1,331 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_virtual_panel.h"
+#include "qp_tft_panel.h"
+#include "qp_surface_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Common
+
+// MIPI DCS opcodes understood by the virtual panel
+#define VIRTUAL_PANEL_CMD_DISPLAY_OFF 0x28
+#define VIRTUAL_PANEL_CMD_DISPLAY_ON 0x29
+#define VIRTUAL_PANEL_SET_COL_ADDR 0x2A
+#define VIRTUAL_PANEL_SET_ROW_ADDR 0x2B
+#define VIRTUAL_PANEL_SET_MEM 0x2C
+
+// Device definition
+typedef struct virtual_panel_painter_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // Emulated GRAM, which takes care of the windowing and wrapping of streamed pixel data
+    surface_painter_device_t gram;
+
+    // Command decoding
+    uint8_t  command;
+    uint8_t  param_count;
+    uint8_t  params[4];
+    uint16_t window_l;
+    uint16_t window_t;
+    uint16_t window_r;
+    uint16_t window_b;
+    bool     display_on;
+    bool     comms_active;
+
+    // Outstanding asynchronous transfer
+    const void *async_data;
+    uint32_t    async_byte_count;
+    uint32_t    async_checksum;
+    const void *async_last_data;
+
+    // Transfer accounting
+    qp_virtual_panel_stats_t stats;
+} virtual_panel_painter_device_t;
+
+// Driver storage
+static virtual_panel_painter_device_t virtual_panel_drivers[VIRTUAL_PANEL_NUM_DEVICES] = {0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Virtual comms -- decodes the command stream sent by the TFT panel routines
+
+static uint32_t virtual_panel_send_data(painter_device_t device, const void *data, uint32_t byte_count);
+
+static uint32_t virtual_panel_checksum(const void *data, uint32_t byte_count) {
+    // FNV-1a
+    const uint8_t *p    = (const uint8_t *)data;
+    uint32_t       hash = 2166136261u;
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Completes the outstanding asynchronous transfer, if any, reading its data into GRAM
+static void virtual_panel_complete_async(virtual_panel_painter_device_t *panel) {
+    if (!panel->async_data) {
+        return;
+    }
+
+    const void *data       = panel->async_data;
+    panel->async_data      = NULL;
+    panel->async_last_data = data;
+    if (virtual_panel_checksum(data, panel->async_byte_count) != panel->async_checksum) {
+        panel->stats.async_modified++;
+    }
+    virtual_panel_send_data((painter_device_t)panel, data, panel->async_byte_count);
+}
+
+// Anything other than waiting needs the outstanding transfer to have been completed beforehand
+static void virtual_panel_check_order(virtual_panel_painter_device_t *panel) {
+    if (panel->async_data) {
+        panel->stats.order_errors++;
+        virtual_panel_complete_async(panel);
+    }
+}
+
+static bool virtual_panel_comms_init(painter_device_t device) {
+    // No-op.
+    return true;
+}
+
+static bool virtual_panel_comms_start(painter_device_t device) {
+    // Only tracked, so that tests can check when the bus is released
+    ((virtual_panel_painter_device_t *)device)->comms_active = true;
+    return true;
+}
+
+static void virtual_panel_comms_stop(painter_device_t device) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    virtual_panel_check_order(panel);
+    panel->comms_active = false;
+}
+
+static void virtual_panel_send_command(painter_device_t device, uint8_t cmd) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    virtual_panel_check_order(panel);
+    panel->stats.bytes_sent++;
+    panel->stats.command_count++;
+
+    panel->command     = cmd;
+    panel->param_count = 0;
+
+    switch (cmd) {
+        case VIRTUAL_PANEL_CMD_DISPLAY_OFF:
+            panel->display_on = false;
+            break;
+        case VIRTUAL_PANEL_CMD_DISPLAY_ON:
+            panel->display_on = true;
+            break;
+        case VIRTUAL_PANEL_SET_MEM:
+            // Start writing at the top left of the window
+            panel->stats.viewport_count++;
+            qp_surface_viewport((painter_device_t)&panel->gram, panel->window_l, panel->window_t, panel->window_r, panel->window_b);
+            break;
+    }
+}
+
+static uint32_t virtual_panel_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    virtual_panel_check_order(panel);
+    panel->stats.bytes_sent += byte_count;
+
+    if (panel->command == VIRTUAL_PANEL_SET_MEM) {
+        panel->stats.pixdata_bytes += byte_count;
+        panel->gram.base.driver_vtable->pixdata((painter_device_t)&panel->gram, data, byte_count / sizeof(uint16_t));
+        return byte_count;
+    }
+
+    // Accumulate command parameters
+    const uint8_t *p = (const uint8_t *)data;
+    for (uint32_t i = 0; i < byte_count && panel->param_count < sizeof(panel->params); ++i) {
+        panel->params[panel->param_count++] = p[i];
+    }
+
+    if (panel->param_count == sizeof(panel->params)) {
+        uint16_t start = ((uint16_t)panel->params[0]) << 8 | panel->params[1];
+        uint16_t end   = ((uint16_t)panel->params[2]) << 8 | panel->params[3];
+        if (panel->command == VIRTUAL_PANEL_SET_COL_ADDR) {
+            panel->window_l = start;
+            panel->window_r = end;
+        } else if (panel->command == VIRTUAL_PANEL_SET_ROW_ADDR) {
+            panel->window_t = start;
+            panel->window_b = end;
+        }
+    }
+
+    return byte_count;
+}
+
+static uint32_t virtual_panel_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    virtual_panel_check_order(panel);
+    panel->stats.async_count++;
+    if (panel->async_last_data && panel->async_last_data != data) {
+        panel->stats.async_swaps++;
+    }
+
+    // Nothing's read until the transfer is waited upon
+    panel->async_data       = data;
+    panel->async_byte_count = byte_count;
+    panel->async_checksum   = virtual_panel_checksum(data, byte_count);
+    return byte_count;
+}
+
+static void virtual_panel_wait(painter_device_t device) {
+    virtual_panel_complete_async((virtual_panel_painter_device_t *)device);
+}
+
+static void virtual_panel_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t command   = sequence[i];
+        uint8_t num_bytes = sequence[i + 2];
+        virtual_panel_send_command(device, command);
+        if (num_bytes > 0) {
+            virtual_panel_send_data(device, &sequence[i + 3], num_bytes);
+        }
+        // Delays are skipped, there's no hardware to wait for.
+        i += (3 + num_bytes);
+    }
+}
+
+static const painter_comms_with_command_vtable_t virtual_panel_comms_vtable = {
+    .base =
+        {
+            .comms_init  = virtual_panel_comms_init,
+            .comms_start = virtual_panel_comms_start,
+            .comms_send  = virtual_panel_send_data,
+            .comms_stop  = virtual_panel_comms_stop,
+
+            .comms_send_async = virtual_panel_send_data_async,
+            .comms_wait       = virtual_panel_wait,
+        },
+    .send_command          = virtual_panel_send_command,
+    .bulk_command_sequence = virtual_panel_bulk_command_sequence,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Initialization
+
+static bool qp_virtual_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+
+    // There's no MADCTL equivalent, so only the native orientation is supported
+    if (rotation != QP_ROTATION_0) {
+        qp_dprintf("qp_virtual_panel_init: fail (unsupported rotation)\n");
+        return false;
+    }
+
+    // Clear GRAM, and reset the window to the full panel
+    qp_surface_init((painter_device_t)&panel->gram, rotation);
+    panel->window_l = 0;
+    panel->window_t = 0;
+    panel->window_r = panel->base.panel_width - 1;
+    panel->window_b = panel->base.panel_height - 1;
+
+    // clang-format off
+    const uint8_t virtual_panel_init_sequence[] = {
+        // Command,                 Delay, N, Data[N]
+        VIRTUAL_PANEL_CMD_DISPLAY_ON,   20, 0
+    };
+    // clang-format on
+    qp_comms_bulk_command_sequence(device, virtual_panel_init_sequence, sizeof(virtual_panel_init_sequence));
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pixel conversion -- counted, so that palette reuse can be verified
+
+static bool qp_virtual_panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    panel->stats.palette_count += palette_size;
+    return qp_tft_panel_palette_convert_rgb565_swapped(device, palette_size, palette);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtable
+
+const tft_panel_dc_reset_painter_driver_vtable_t virtual_panel_driver_vtable = {
+    .base =
+        {
+            .init            = qp_virtual_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_virtual_panel_palette_convert,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = VIRTUAL_PANEL_CMD_DISPLAY_ON,
+            .display_off        = VIRTUAL_PANEL_CMD_DISPLAY_OFF,
+            .set_column_address = VIRTUAL_PANEL_SET_COL_ADDR,
+            .set_row_address    = VIRTUAL_PANEL_SET_ROW_ADDR,
+            .enable_writes      = VIRTUAL_PANEL_SET_MEM,
+        },
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory function for creating a handle to the virtual panel
+
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, void *buffer) {
+    for (uint32_t i = 0; i < VIRTUAL_PANEL_NUM_DEVICES; ++i) {
+        virtual_panel_painter_device_t *driver = &virtual_panel_drivers[i];
+        if (!driver->base.driver_vtable) {
+            driver->base.driver_vtable         = (const painter_driver_vtable_t *)&virtual_panel_driver_vtable;
+            driver->base.comms_vtable          = (const painter_comms_vtable_t *)&virtual_panel_comms_vtable;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+            driver->base.native_bits_per_pixel = 16; // RGB565
+
+            // GRAM is a surface of the same geometry, backed by the supplied buffer
+            if (!qp_make_rgb565_surface_advanced(&driver->gram, 1, panel_width, panel_height, buffer)) {
+                memset(driver, 0, sizeof(virtual_panel_painter_device_t));
+                return NULL;
+            }
+
+            if (!qp_internal_register_device((painter_device_t)driver)) {
+                memset(driver, 0, sizeof(virtual_panel_painter_device_t));
+                return NULL;
+            }
+
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Inspection
+
+uint16_t qp_virtual_panel_get_pixel(painter_device_t device, uint16_t x, uint16_t y) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    if (x >= panel->base.panel_width || y >= panel->base.panel_height) {
+        return 0;
+    }
+
+    // GRAM holds pixels in transmission order, i.e. big-endian
+    return __builtin_bswap16(panel->gram.u16buffer[y * panel->base.panel_width + x]);
+}
+
+void qp_virtual_panel_get_stats(painter_device_t device, qp_virtual_panel_stats_t *stats) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    *stats                                = panel->stats;
+    stats->comms_active                   = panel->comms_active;
+}
+
+void qp_virtual_panel_reset_stats(painter_device_t device) {
+    virtual_panel_painter_device_t *panel = (virtual_panel_painter_device_t *)device;
+    memset(&panel->stats, 0, sizeof(qp_virtual_panel_stats_t));
+    panel->async_last_data = NULL;
+}
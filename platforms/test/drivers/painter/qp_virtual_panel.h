@@ -0,0 +1,76 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "qp_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter virtual panel configurables
+
+#ifndef VIRTUAL_PANEL_NUM_DEVICES
+/**
+ * @def This controls the maximum number of virtual panels that Quantum Painter can communicate with at any one time.
+ */
+#    define VIRTUAL_PANEL_NUM_DEVICES 1
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter virtual panel statistics
+
+typedef struct qp_virtual_panel_stats_t {
+    uint32_t bytes_sent;     // Total bytes sent to the panel, including commands and command parameters
+    uint32_t pixdata_bytes;  // Bytes of pixel data written to GRAM
+    uint32_t command_count;  // Number of commands sent
+    uint32_t viewport_count; // Number of GRAM writes started, i.e. viewport changes
+    uint32_t palette_count;  // Number of palette entries converted to the panel's native format
+    uint32_t async_count;    // Number of asynchronous transfers started
+    uint32_t async_swaps;    // Number of asynchronous transfers sent from a different buffer than the previous one
+    uint32_t async_modified; // Number of asynchronous transfers whose data was modified before the transfer completed
+    uint32_t order_errors;   // Number of comms operations issued while an asynchronous transfer was still outstanding
+    bool     comms_active;   // Whether comms are currently started, i.e. the bus is held by the panel
+} qp_virtual_panel_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter virtual panel device factories
+
+/**
+ * Factory method for a virtual RGB565 panel, intended for host-side testing.
+ *
+ * The virtual panel behaves like a MIPI DCS-compatible TFT panel (such as the ST7789 or ILI9341) -- it uses the common
+ * TFT panel driver routines, and decodes the resulting command stream into an emulated GRAM, accounting for all bytes
+ * sent along the way. Only QP_ROTATION_0 is supported.
+ *
+ * Asynchronous transfers behave like DMA -- the data is only read into GRAM once the transfer is waited upon, so any
+ * modification of a buffer that's still in flight shows up in the rendered output as well as in the statistics.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 16)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, void *buffer);
+
+/**
+ * Retrieves the RGB565 value of a pixel within the emulated GRAM.
+ *
+ * @param device[in] the handle of the virtual panel
+ * @param x[in] the x coordinate of the pixel
+ * @param y[in] the y coordinate of the pixel
+ * @return the RGB565 value of the pixel, or 0 if it's outside the panel
+ */
+uint16_t qp_virtual_panel_get_pixel(painter_device_t device, uint16_t x, uint16_t y);
+
+/**
+ * Retrieves the accumulated transfer statistics of the virtual panel.
+ *
+ * @param device[in] the handle of the virtual panel
+ * @param stats[out] the statistics accumulated since the last reset
+ */
+void qp_virtual_panel_get_stats(painter_device_t device, qp_virtual_panel_stats_t *stats);
+
+/**
+ * Resets the accumulated transfer statistics of the virtual panel.
+ *
+ * @param device[in] the handle of the virtual panel
+ */
+void qp_virtual_panel_reset_stats(painter_device_t device);
@@ -0,0 +1,22 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PS/2 host mock
+//
+// Provides the PS/2 host API for the test platform. Every command is acknowledged, and bytes from the device are
+// injected through ps2_mock_receive(), which behaves like the receive interrupt of an interrupt driven PS/2 driver.
+
+#ifndef PS2_MOCK_BUFFER_SIZE
+#    define PS2_MOCK_BUFFER_SIZE 32
+#endif
+
+// Drops any buffered bytes
+void ps2_mock_reset(void);
+
+// Delivers a byte from the device as the receive interrupt would -- valid is false if it failed framing or parity checks
+void ps2_mock_receive(uint8_t data, bool valid);
@@ -0,0 +1,69 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "ps2.h"
+#include "ps2_mock.h"
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+#    include "ps2_mouse.h"
+#endif
+
+uint8_t ps2_error = PS2_ERR_NONE;
+
+// Bytes which were not taken for mouse packets, as read by ps2_host_recv_response()
+static uint8_t pbuf[PS2_MOCK_BUFFER_SIZE];
+static uint8_t pbuf_head = 0;
+static uint8_t pbuf_tail = 0;
+
+void ps2_mock_reset(void) {
+    pbuf_head = 0;
+    pbuf_tail = 0;
+}
+
+void ps2_mock_receive(uint8_t data, bool valid) {
+#ifdef PS2_MOUSE_USE_PACKET_QUEUE
+    if (ps2_mouse_packet_receive(data, valid)) {
+        return;
+    }
+#endif
+    if (!valid) {
+        ps2_error = PS2_ERR_PARITY;
+        return;
+    }
+    uint8_t next = (pbuf_head + 1) % PS2_MOCK_BUFFER_SIZE;
+    if (next != pbuf_tail) {
+        pbuf[pbuf_head] = data;
+        pbuf_head       = next;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PS/2 host
+
+void ps2_host_init(void) {
+    ps2_mock_reset();
+}
+
+uint8_t ps2_host_send(uint8_t data) {
+    ps2_error = PS2_ERR_NONE;
+    return PS2_ACK;
+}
+
+uint8_t ps2_host_recv_response(void) {
+    return ps2_host_recv();
+}
+
+uint8_t ps2_host_recv(void) {
+    if (!pbuf_has_data()) {
+        ps2_error = PS2_ERR_NODATA;
+        return 0;
+    }
+    uint8_t data = pbuf[pbuf_tail];
+    pbuf_tail    = (pbuf_tail + 1) % PS2_MOCK_BUFFER_SIZE;
+    ps2_error    = PS2_ERR_NONE;
+    return data;
+}
+
+void ps2_host_set_led(uint8_t usb_led) {}
+
+bool pbuf_has_data(void) {
+    return pbuf_head != pbuf_tail;
+}
@@ -0,0 +1,251 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+#include "oled_transport_mock.h"
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+// Commands used when rendering, from the SSD1306/SH1106 datasheets
+#define COLUMN_ADDR 0x21
+#define PAGE_ADDR 0x22
+#define PAM_SETCOLUMN_LSB 0x00
+#define PAM_SETCOLUMN_MSB 0x10
+#define PAM_PAGE_ADDR 0xB0
+#define I2C_CMD 0x00
+#define I2C_DATA 0x40
+
+// Reference implementation of the render path as it was before rotation used lookup tables and blocks were sent
+// asynchronously, producing the transfers expected of the driver in the same format as the mock records them
+class ReferenceRenderer {
+   public:
+    std::vector<std::uint8_t> render(const std::uint8_t* buffer, OLED_BLOCK_TYPE dirty, bool rotated, bool all) {
+        log.clear();
+        std::uint8_t update_start  = 0;
+        std::uint8_t num_processed = 0;
+        while (dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) {
+            while (!(dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
+                ++update_start;
+            }
+#if OLED_IC == OLED_IC_SSD1306
+            std::vector<std::uint8_t> display_start = {COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+            std::vector<std::uint8_t> display_start = {PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+            rotated ? calc_bounds_90(update_start, display_start.data()) : calc_bounds(update_start, display_start.data());
+            record(I2C_CMD, display_start.data(), display_start.size());
+
+            if (!rotated) {
+                record(I2C_DATA, &buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE);
+            } else {
+                const std::uint8_t source_map[] = OLED_SOURCE_MAP;
+                const std::uint8_t target_map[] = OLED_TARGET_MAP;
+                std::uint8_t       temp_buffer[OLED_BLOCK_SIZE];
+                std::memset(temp_buffer, 0, sizeof(temp_buffer));
+                for (std::uint8_t i = 0; i < sizeof(source_map); ++i) {
+                    rotate_90(&buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+                }
+#if OLED_IC == OLED_IC_SSD1306
+                record(I2C_DATA, temp_buffer, OLED_BLOCK_SIZE);
+#else
+                const std::uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
+                const std::uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
+                for (std::uint8_t i = 0; i < num_pages; ++i) {
+                    if (i > 0) {
+                        display_start[0]++;
+                        record(I2C_CMD, display_start.data(), display_start.size());
+                    }
+                    record(I2C_DATA, &temp_buffer[columns_in_block * i], columns_in_block);
+                }
+#endif
+            }
+            dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        }
+        return log;
+    }
+
+   private:
+    std::vector<std::uint8_t> log;
+
+    void record(std::uint8_t control, const std::uint8_t* data, std::uint16_t size) {
+        log.push_back(control);
+        log.push_back((std::uint8_t)size);
+        log.push_back((std::uint8_t)(size >> 8));
+        log.insert(log.end(), data, data + size);
+    }
+
+    static void calc_bounds(std::uint8_t update_start, std::uint8_t* cmd_array) {
+        std::uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
+        std::uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+#if OLED_IC != OLED_IC_SSD1306
+        cmd_array[0] = PAM_PAGE_ADDR | start_page;
+        cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
+        cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+#else
+        cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
+        cmd_array[4] = start_page;
+        cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
+        cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+#endif
+    }
+
+    static void calc_bounds_90(std::uint8_t update_start, std::uint8_t* cmd_array) {
+        const std::uint8_t height_in_pages       = OLED_DISPLAY_HEIGHT / 8;
+        const std::uint8_t page_inc_per_block    = OLED_BLOCK_SIZE % OLED_DISPLAY_HEIGHT / 8;
+        const std::uint8_t bottom_block_top_page = (height_in_pages - page_inc_per_block) % height_in_pages;
+#if OLED_IC != OLED_IC_SSD1306
+        std::uint8_t start_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
+        std::uint8_t start_column = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
+        cmd_array[0]              = PAM_PAGE_ADDR | start_page;
+        cmd_array[1]              = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
+        cmd_array[2]              = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
+#else
+        cmd_array[1] = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8 + OLED_COLUMN_OFFSET;
+        cmd_array[4] = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
+        cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8 - 1 + cmd_array[1];
+        cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) % OLED_DISPLAY_HEIGHT / 8 + cmd_array[4];
+#endif
+    }
+
+    static std::uint8_t crot(std::uint8_t a, std::int8_t n) {
+        const std::uint8_t mask = 0x7;
+        n &= mask;
+        return a << n | a >> (-n & mask);
+    }
+
+    static void rotate_90(const std::uint8_t* src, std::uint8_t* dest) {
+        for (std::uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
+            std::uint8_t selector = (1 << i);
+            for (std::uint8_t j = 0; j < 8; ++j) {
+                dest[i] |= crot(src[j] & selector, shift - (std::int8_t)j);
+            }
+        }
+    }
+};
+
+class OledDriver : public ::testing::Test {
+   protected:
+    void init(oled_rotation_t rotation) {
+        ASSERT_TRUE(oled_init(rotation)) << "Failed to initialise OLED";
+        oled_render_dirty(true);
+        oled_transport_mock_reset();
+    }
+
+    // Fills the display buffer with a reproducible pattern, marking every block dirty
+    void fill_random(unsigned seed) {
+        std::mt19937 rng(seed);
+        for (std::uint16_t i = 0; i < OLED_MATRIX_SIZE; ++i) {
+            oled_write_raw_byte((char)rng(), i);
+        }
+    }
+
+    void expect_matches_reference(bool rotated, bool all) {
+        std::vector<std::uint8_t> buffer(oled_buffer, oled_buffer + OLED_MATRIX_SIZE);
+        std::vector<std::uint8_t> expected = ReferenceRenderer().render(buffer.data(), oled_dirty, rotated, all);
+
+        oled_render_dirty(all);
+
+        const std::uint8_t* log;
+        std::size_t         length = oled_transport_mock_get_log(&log);
+        ASSERT_EQ(std::vector<std::uint8_t>(log, log + length), expected) << "Transfers differ from the reference render path";
+
+        oled_transport_mock_stats_t stats;
+        oled_transport_mock_get_stats(&stats);
+        EXPECT_EQ(stats.async_modified, 0) << "Data was modified while it was being sent";
+        EXPECT_EQ(stats.order_errors, 0) << "Transfers were issued while data was still being sent";
+        EXPECT_FALSE(stats.bus_active) << "Bus was left held after rendering";
+        EXPECT_TRUE(stats.async_ended) << "Data was still being sent after rendering";
+    }
+};
+
+/**
+ * This test verifies that unrotated rendering sends the same data as the reference render path.
+ */
+TEST_F(OledDriver, Rotation0_MatchesReference) {
+    init(OLED_ROTATION_0);
+    fill_random(1);
+    expect_matches_reference(false, true);
+}
+
+/**
+ * This test verifies that table-driven rotation sends the same data as the reference render path.
+ */
+TEST_F(OledDriver, Rotation90_MatchesReference) {
+    init(OLED_ROTATION_90);
+    for (unsigned seed = 0; seed < 16; ++seed) {
+        fill_random(seed);
+        expect_matches_reference(true, true);
+        oled_transport_mock_reset();
+    }
+}
+
+/**
+ * This test verifies that every single-bit pattern is rotated correctly.
+ */
+TEST_F(OledDriver, Rotation270_SingleBits) {
+    init(OLED_ROTATION_270);
+    for (std::uint16_t bit = 0; bit < 64; ++bit) {
+        oled_clear();
+        oled_write_raw_byte((char)(1 << (bit % 8)), bit / 8);
+        expect_matches_reference(true, true);
+        oled_transport_mock_reset();
+    }
+}
+
+/**
+ * This test verifies that rendering a limited number of dirty blocks per call matches the reference render path.
+ */
+TEST_F(OledDriver, PartialRender_MatchesReference) {
+    init(OLED_ROTATION_90);
+    fill_random(42);
+    while (oled_dirty) {
+        expect_matches_reference(true, false);
+        oled_transport_mock_reset();
+    }
+}
+
+/**
+ * This test verifies that rotated blocks are sent asynchronously, without stalling on each block in turn.
+ */
+TEST_F(OledDriver, Rotated_SentAsynchronously) {
+    init(OLED_ROTATION_90);
+    fill_random(7);
+    oled_render_dirty(true);
+
+    oled_transport_mock_stats_t stats;
+    oled_transport_mock_get_stats(&stats);
+    EXPECT_GE(stats.async_count, OLED_BLOCK_COUNT);
+    EXPECT_EQ(stats.async_modified, 0);
+    EXPECT_EQ(stats.order_errors, 0);
+}
+
+/**
+ * This test verifies that a transfer failing part way through rendering still completes any outstanding transfer and
+ * releases the bus, and that the blocks left dirty are rendered correctly afterwards.
+ */
+TEST_F(OledDriver, FailedTransfer_ReleasesBus) {
+    init(OLED_ROTATION_90);
+    for (std::uint32_t fail_at = 1; fail_at <= 6; ++fail_at) {
+        fill_random(fail_at);
+        oled_transport_mock_fail_start(fail_at);
+        oled_render_dirty(true);
+
+        oled_transport_mock_stats_t stats;
+        oled_transport_mock_get_stats(&stats);
+        EXPECT_EQ(stats.async_modified, 0) << "Data was modified while it was being sent";
+        EXPECT_EQ(stats.order_errors, 0) << "Transfers were issued while data was still being sent";
+        EXPECT_FALSE(stats.bus_active) << "Bus was left held after a failed transfer";
+        EXPECT_TRUE(stats.async_ended) << "Data was still being sent after a failed transfer";
+        EXPECT_NE(oled_dirty, 0) << "Failed block should have been left dirty";
+
+        oled_transport_mock_reset();
+        expect_matches_reference(true, true);
+        oled_transport_mock_reset();
+    }
+}
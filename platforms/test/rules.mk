@@ -23,3 +23,29 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+oled_driver_DEFS := -DNO_PRINT
+oled_driver_ssd1306_DEFS := $(oled_driver_DEFS) \
+	-DOLED_DISPLAY_128X32
+oled_driver_sh1106_DEFS := $(oled_driver_DEFS) \
+	-DOLED_DISPLAY_128X64 \
+	-DOLED_IC=OLED_IC_SH1106
+
+oled_driver_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/oled/oled_transport_mock_config.h
+oled_driver_ssd1306_CONFIG := $(oled_driver_CONFIG)
+oled_driver_sh1106_CONFIG := $(oled_driver_CONFIG)
+
+oled_driver_INC := \
+	$(DRIVER_PATH)/oled \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/oled
+oled_driver_ssd1306_INC := $(oled_driver_INC)
+oled_driver_sh1106_INC := $(oled_driver_INC)
+
+oled_driver_SRC := \
+	$(DRIVER_PATH)/oled/oled_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/oled_driver_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/oled/oled_transport_mock.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+oled_driver_ssd1306_SRC := $(oled_driver_SRC)
+oled_driver_sh1106_SRC := $(oled_driver_SRC)
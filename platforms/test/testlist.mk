@@ -1 +1,3 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+
+TEST_LIST += oled_driver_ssd1306 oled_driver_sh1106
@@ -15,6 +15,8 @@
  */
 
 #include "digitizer.h"
+#include "atomic_util.h"
+#include "timer.h"
 
 digitizer_t digitizer_state = {
     .in_range = false,
@@ -25,13 +27,95 @@ digitizer_t digitizer_state = {
     .dirty    = false,
 };
 
+static struct {
+    digitizer_sample_t samples[DIGITIZER_SAMPLE_QUEUE_SIZE];
+    uint8_t            tail;
+    uint8_t            count;
+} queue;
+
+static digitizer_sample_t last_sent;
+static bool               sent_any;
+static uint16_t           last_report_time;
+
+static inline bool same_switches(digitizer_sample_t a, digitizer_sample_t b) {
+    return a.in_range == b.in_range && a.tip == b.tip && a.barrel == b.barrel;
+}
+
+/**
+ * \brief Send a sample to the host, unless it would repeat the last report sent.
+ */
+static void digitizer_send(digitizer_sample_t sample) {
+    if (sent_any && same_switches(sample, last_sent) && sample.x == last_sent.x && sample.y == last_sent.y) {
+        return;
+    }
+    host_digitizer_send_sample(&sample);
+    last_sent        = sample;
+    sent_any         = true;
+    last_report_time = timer_read();
+}
+
 void digitizer_flush(void) {
     if (digitizer_state.dirty) {
-        host_digitizer_send(&digitizer_state);
+        digitizer_sample_t sample = {
+            .in_range = digitizer_state.in_range,
+            .tip      = digitizer_state.tip,
+            .barrel   = digitizer_state.barrel,
+            .x        = (uint16_t)(digitizer_state.x * DIGITIZER_POSITION_MAX),
+            .y        = (uint16_t)(digitizer_state.y * DIGITIZER_POSITION_MAX),
+        };
+        digitizer_send(sample);
         digitizer_state.dirty = false;
     }
 }
 
+bool digitizer_push_sample(digitizer_sample_t sample) {
+    bool queued = true;
+    ATOMIC_BLOCK_RESTORESTATE {
+        if (queue.count < DIGITIZER_SAMPLE_QUEUE_SIZE) {
+            queue.samples[(queue.tail + queue.count) % DIGITIZER_SAMPLE_QUEUE_SIZE] = sample;
+            queue.count++;
+        } else {
+            digitizer_sample_t *newest = &queue.samples[(queue.tail + queue.count - 1) % DIGITIZER_SAMPLE_QUEUE_SIZE];
+            if (same_switches(*newest, sample)) {
+                *newest = sample;
+            } else {
+                queued = false;
+            }
+        }
+    }
+    return queued;
+}
+
+void digitizer_task(void) {
+    if (sent_any && timer_elapsed(last_report_time) < DIGITIZER_REPORT_INTERVAL_MS) {
+        return;
+    }
+
+    // Only the latest position matters to the host, so samples are merged up to the next switch change, which is left
+    // for the following report so that no press or release is lost
+    digitizer_sample_t sample;
+    bool               pending = false;
+    ATOMIC_BLOCK_RESTORESTATE {
+        while (queue.count && (!pending || same_switches(sample, queue.samples[queue.tail]))) {
+            sample     = queue.samples[queue.tail];
+            pending    = true;
+            queue.tail = (queue.tail + 1) % DIGITIZER_SAMPLE_QUEUE_SIZE;
+            queue.count--;
+        }
+    }
+    if (!pending) {
+        return;
+    }
+
+    digitizer_state.in_range = sample.in_range;
+    digitizer_state.tip      = sample.tip;
+    digitizer_state.barrel   = sample.barrel;
+    digitizer_state.x        = (float)sample.x / DIGITIZER_POSITION_MAX;
+    digitizer_state.y        = (float)sample.y / DIGITIZER_POSITION_MAX;
+    digitizer_state.dirty    = false;
+    digitizer_send(sample);
+}
+
 void digitizer_in_range_on(void) {
     digitizer_state.in_range = true;
     digitizer_state.dirty    = true;
@@ -16,7 +16,22 @@
 
 #pragma once
 
+#include <stdint.h>
 #include <stdbool.h>
+#include "compiler_support.h"
+
+// Number of samples that can be queued between reports
+#ifndef DIGITIZER_SAMPLE_QUEUE_SIZE
+#    define DIGITIZER_SAMPLE_QUEUE_SIZE 8
+#endif
+// Shortest time between queued samples being reported, one USB frame by default
+#ifndef DIGITIZER_REPORT_INTERVAL_MS
+#    define DIGITIZER_REPORT_INTERVAL_MS 1
+#endif
+
+STATIC_ASSERT(DIGITIZER_SAMPLE_QUEUE_SIZE > 0 && DIGITIZER_SAMPLE_QUEUE_SIZE <= UINT8_MAX, "DIGITIZER_SAMPLE_QUEUE_SIZE must be between 1 and 255");
+
+#define DIGITIZER_POSITION_MAX 0x7FFF
 
 /**
  * \file
@@ -34,10 +49,21 @@ typedef struct {
     bool  dirty;
 } digitizer_t;
 
+/**
+ * \brief A single reading from a digitizer sensor, in report units.
+ */
+typedef struct {
+    bool     in_range : 1;
+    bool     tip : 1;
+    bool     barrel : 1;
+    uint16_t x; // from 0 to DIGITIZER_POSITION_MAX
+    uint16_t y; // from 0 to DIGITIZER_POSITION_MAX
+} digitizer_sample_t;
+
 extern digitizer_t digitizer_state;
 
 /**
- * \brief Send the digitizer report to the host if it is marked as dirty.
+ * \brief Send the digitizer report to the host if it is marked as dirty, and differs from the last report sent.
  */
 void digitizer_flush(void);
 
@@ -79,6 +105,25 @@ void digitizer_barrel_switch_off(void);
  */
 void digitizer_set_position(float x, float y);
 
+/**
+ * \brief Queue a sample to be sent by `digitizer_task()`. Safe to call from an interrupt.
+ *
+ * Queued samples with the same switch states are sent as a single report of the latest position, at most once per
+ * `DIGITIZER_REPORT_INTERVAL_MS`. When the queue is full, a sample that only moves the contact replaces the newest
+ * queued position.
+ *
+ * \param sample The sample to queue.
+ *
+ * \return false if the queue was full and the sample changes a switch state, so could not be queued.
+ */
+bool digitizer_push_sample(digitizer_sample_t sample);
+
+/**
+ * \brief Send queued samples to the host. Called from the main loop.
+ */
+void digitizer_task(void);
+
 void host_digitizer_send(digitizer_t *digitizer);
+void host_digitizer_send_sample(const digitizer_sample_t *sample);
 
 /** \} */
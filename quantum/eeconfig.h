@@ -137,6 +137,12 @@ void                              eeconfig_read_connection(connection_config_t *
 void                              eeconfig_update_connection(const connection_config_t *config);
 #endif
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+typedef struct pointing_device_accel_config_t pointing_device_accel_config_t;
+void                                          eeconfig_read_pointing_device_accel(pointing_device_accel_config_t *config) __attribute__((nonnull));
+void                                          eeconfig_update_pointing_device_accel(const pointing_device_accel_config_t *config) __attribute__((nonnull));
+#endif
+
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
@@ -92,6 +92,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
+#ifdef DIGITIZER_ENABLE
+#    include "digitizer.h"
+#endif
 #ifdef HD44780_ENABLE
 #    include "hd44780.h"
 #endif
@@ -149,6 +152,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_CACHE_ENABLE)
+#    include "wear_leveling.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -419,6 +425,10 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_CACHE_ENABLE)
+    // deferred EEPROM writes & background consolidation
+    wear_leveling_task();
+#endif
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
@@ -779,6 +789,10 @@ void keyboard_task(void) {
     joystick_task();
 #endif
 
+#ifdef DIGITIZER_ENABLE
+    digitizer_task();
+#endif
+
 #ifdef BATTERY_ENABLE
     battery_task();
 #endif
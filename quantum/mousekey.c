@@ -24,6 +24,11 @@
 #include "debug.h"
 #include "mousekey.h"
 
+#if defined(MK_TIME_INTEGRATED) && defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_HIRES_SCROLL_ENABLE)
+#    include "pointing_device.h"
+#    define MOUSEKEY_HIRES_SCROLL
+#endif
+
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
     // because it is close to the exact value which is 0.707106781
@@ -52,6 +57,17 @@ static int8_t  mousekey_y_inertia = 0; // ...
 #ifdef MK_KINETIC_SPEED
 static uint16_t mouse_timer = 0;
 #endif
+#ifdef MK_TIME_INTEGRATED
+typedef struct {
+    bool     active;       // initial delay has passed
+    uint16_t timer;        // time motion has been integrated up to
+    uint16_t held;         // milliseconds spent accelerating
+    uint16_t remainder[2]; // fraction of a unit carried into the next report, in 1/4096ths
+} mousekey_integrator_t;
+
+static mousekey_integrator_t cursor_integrator = {0};
+static mousekey_integrator_t wheel_integrator  = {0};
+#endif
 
 #ifndef MK_3_SPEED
 
@@ -172,6 +188,10 @@ static uint8_t wheel_unit(void) {
     } else {
         unit = (MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed * mousekey_wheel_repeat) / mk_wheel_time_to_max;
     }
+#            ifdef MOUSEKEY_HIRES_SCROLL
+    // the host divides hi-res wheel motion by the resolution, so scale up to keep whole notches
+    unit = MIN((uint32_t)unit * pointing_device_get_hires_scroll_resolution(), MOUSEKEY_WHEEL_MAX);
+#            endif
     return (unit > MOUSEKEY_WHEEL_MAX ? MOUSEKEY_WHEEL_MAX : (unit == 0 ? 1 : unit));
 }
 
@@ -304,6 +324,80 @@ static int8_t calc_inertia(int8_t direction, int8_t velocity) {
 
 #    endif
 
+#    ifdef MK_TIME_INTEGRATED
+
+/*
+ * Time-integrated mode
+ *
+ * Speed ramps up over time_to_max intervals as in the default mode, but the motion is integrated over the time that has
+ * actually passed instead of being stepped once per interval, so the pointer travels at the same rate however often
+ * the task runs. Fractions of a unit are carried over to the next report.
+ */
+
+// distances are worked out in 1/4096ths of a unit
+#        define INTEGRATED_SHIFT 12
+// faster than any report can carry
+#        define INTEGRATED_RATE_MAX ((uint32_t)128 << INTEGRATED_SHIFT)
+
+/* speed in 1/4096 units per interval after accelerating for held milliseconds */
+static uint32_t integrated_speed(uint16_t held, uint16_t max_unit, uint8_t time_to_max, uint8_t interval) {
+    uint16_t fraction; // of max speed, in 1/4096ths
+    if (mousekey_accel & (1 << 0)) {
+        fraction = 1 << (INTEGRATED_SHIFT - 2);
+    } else if (mousekey_accel & (1 << 1)) {
+        fraction = 1 << (INTEGRATED_SHIFT - 1);
+    } else if (mousekey_accel & (1 << 2)) {
+        fraction = 1 << INTEGRATED_SHIFT;
+    } else {
+        // as in the default mode, the first interval after the delay moves at the first step of the ramp
+        uint32_t ramp     = (uint32_t)time_to_max * interval;
+        uint32_t position = (uint32_t)held + interval;
+        fraction          = position >= ramp ? 1 << INTEGRATED_SHIFT : (position << INTEGRATED_SHIFT) / ramp;
+    }
+    // no slower than one unit per interval
+    return MAX((uint32_t)max_unit * fraction, (uint32_t)1 << INTEGRATED_SHIFT);
+}
+
+/*
+ * distance in 1/4096 units travelled since the previous call, nothing until the initial delay has passed
+ *
+ * diagonal scales the speed by 1/sqrt(2), and multiplier by a whole number, such as the hi-res scroll resolution
+ */
+static uint32_t integrate(mousekey_integrator_t *integrator, uint16_t start_time, uint16_t delay, uint16_t max_unit, uint8_t time_to_max, uint8_t interval, bool diagonal, uint16_t multiplier) {
+    if (!integrator->active) {
+        if (timer_elapsed(start_time) <= delay) return 0;
+        integrator->active = true;
+        integrator->timer  = start_time + delay;
+    }
+
+    uint16_t elapsed = timer_elapsed(integrator->timer);
+    integrator->timer += elapsed;
+    // motion missed during a longer stall is not made up
+    if (elapsed > UINT8_MAX) elapsed = UINT8_MAX;
+
+    // the ramp is linear, so averaging the speed at either end follows it closely
+    uint32_t speed = integrated_speed(integrator->held, max_unit, time_to_max, interval);
+    if (integrator->held < UINT16_MAX - UINT8_MAX) integrator->held += elapsed;
+    speed += integrated_speed(integrator->held, max_unit, time_to_max, interval);
+
+    // scale before dividing by the interval, so that slow wheel speeds keep their precision
+    const uint32_t speed_max = INTEGRATED_RATE_MAX * 2 * interval;
+    speed                    = MIN(speed, speed_max);
+    if (diagonal) speed = speed / 256 * 181;
+    speed = speed > speed_max / multiplier ? speed_max : speed * multiplier;
+    return speed / (2 * interval) * elapsed;
+}
+
+/* whole units of the distance, carrying the fraction into the next report */
+static uint8_t integrated_unit(uint32_t distance, uint16_t *remainder, uint8_t max) {
+    distance += *remainder;
+    *remainder = distance & ((1 << INTEGRATED_SHIFT) - 1);
+    distance >>= INTEGRATED_SHIFT;
+    return distance > max ? max : distance;
+}
+
+#    endif
+
 void mousekey_task(void) {
     // report cursor and scroll movement independently
     report_mouse_t tmpmr = mouse_report;
@@ -337,6 +431,16 @@ void mousekey_task(void) {
         tmpmr.y        = 0;
     }
 
+#    elif defined(MK_TIME_INTEGRATED)
+
+    if (tmpmr.x || tmpmr.y) {
+        /* diagonal move [1/sqrt(2)] */
+        uint32_t distance = integrate(&cursor_integrator, last_timer_c, mk_delay * 10, MOUSEKEY_MOVE_DELTA * mk_max_speed, mk_time_to_max, MAX(mk_interval, 1), tmpmr.x && tmpmr.y, 1);
+
+        if (tmpmr.x != 0) mouse_report.x = integrated_unit(distance, &cursor_integrator.remainder[0], MOUSEKEY_MOVE_MAX) * ((tmpmr.x > 0) ? 1 : -1);
+        if (tmpmr.y != 0) mouse_report.y = integrated_unit(distance, &cursor_integrator.remainder[1], MOUSEKEY_MOVE_MAX) * ((tmpmr.y > 0) ? 1 : -1);
+    }
+
 #    else // default acceleration
 
     if ((tmpmr.x || tmpmr.y) && timer_elapsed(last_timer_c) > (mousekey_repeat ? mk_interval : mk_delay * 10)) {
@@ -359,6 +463,24 @@ void mousekey_task(void) {
 
 #    endif // MOUSEKEY_INERTIA or not
 
+#    ifdef MK_TIME_INTEGRATED
+
+    if (tmpmr.v || tmpmr.h) {
+#        ifdef MOUSEKEY_HIRES_SCROLL
+        // the host divides hi-res wheel motion by the resolution, so each notch is that many units
+        uint16_t multiplier = pointing_device_get_hires_scroll_resolution();
+#        else
+        uint16_t multiplier = 1;
+#        endif
+        /* diagonal move [1/sqrt(2)] */
+        uint32_t distance = integrate(&wheel_integrator, last_timer_w, mk_wheel_delay * 10, MOUSEKEY_WHEEL_DELTA * mk_wheel_max_speed, mk_wheel_time_to_max, MAX(mk_wheel_interval, 1), tmpmr.v && tmpmr.h, multiplier);
+
+        if (tmpmr.v != 0) mouse_report.v = integrated_unit(distance, &wheel_integrator.remainder[0], MOUSEKEY_WHEEL_MAX) * ((tmpmr.v > 0) ? 1 : -1);
+        if (tmpmr.h != 0) mouse_report.h = integrated_unit(distance, &wheel_integrator.remainder[1], MOUSEKEY_WHEEL_MAX) * ((tmpmr.h > 0) ? 1 : -1);
+    }
+
+#    else
+
     if ((tmpmr.v || tmpmr.h) && timer_elapsed(last_timer_w) > (mousekey_wheel_repeat ? mk_wheel_interval : mk_wheel_delay * 10)) {
         if (mousekey_wheel_repeat != UINT8_MAX) mousekey_wheel_repeat++;
         if (tmpmr.v != 0) mouse_report.v = wheel_unit() * ((tmpmr.v > 0) ? 1 : -1);
@@ -377,6 +499,8 @@ void mousekey_task(void) {
         }
     }
 
+#    endif // MK_TIME_INTEGRATED or not
+
     if (has_mouse_report_changed(&mouse_report, &tmpmr) || should_mousekey_report_send(&mouse_report)) {
         mousekey_send();
     }
@@ -397,6 +521,10 @@ void mousekey_on(uint8_t code) {
     if (mouse_report.x || mouse_report.y || mouse_report.h || mouse_report.v) {
 #        ifdef MK_KINETIC_SPEED
         mouse_timer = timer_read() - MOUSEKEY_OVERLAP_INTERVAL;
+#        elif defined(MK_TIME_INTEGRATED)
+        // carry on as though acceleration had repeated as many times as the default mode would
+        cursor_integrator.held = MOUSEKEY_OVERLAP_MOVE_DELTA * mk_interval;
+        wheel_integrator.held  = MOUSEKEY_OVERLAP_WHEEL_DELTA * mk_wheel_interval;
 #        else
         mousekey_repeat       = MOUSEKEY_OVERLAP_MOVE_DELTA;
         mousekey_wheel_repeat = MOUSEKEY_OVERLAP_WHEEL_DELTA;
@@ -493,8 +621,16 @@ void mousekey_off(uint8_t code) {
 #    ifdef MK_KINETIC_SPEED
         mouse_timer = 0;
 #    endif /* #ifdef MK_KINETIC_SPEED */
+#    ifdef MK_TIME_INTEGRATED
+        cursor_integrator = (mousekey_integrator_t){0};
+#    endif
+    }
+    if (mouse_report.v == 0 && mouse_report.h == 0) {
+        mousekey_wheel_repeat = 0;
+#    ifdef MK_TIME_INTEGRATED
+        wheel_integrator = (mousekey_integrator_t){0};
+#    endif
     }
-    if (mouse_report.v == 0 && mouse_report.h == 0) mousekey_wheel_repeat = 0;
 }
 
 #else /* #ifndef MK_3_SPEED */
@@ -650,6 +786,10 @@ void mousekey_clear(void) {
     mousekey_x_dir     = 0;
     mousekey_y_dir     = 0;
 #endif
+#ifdef MK_TIME_INTEGRATED
+    cursor_integrator = (mousekey_integrator_t){0};
+    wheel_integrator  = (mousekey_integrator_t){0};
+#endif
 }
 
 static void mousekey_debug(void) {
@@ -22,6 +22,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #ifndef MK_3_SPEED
 
+#    if defined(MK_TIME_INTEGRATED) && (defined(MK_KINETIC_SPEED) || defined(MK_COMBINED) || defined(MOUSEKEY_INERTIA))
+#        error "MK_TIME_INTEGRATED cannot be used with MK_KINETIC_SPEED, MK_COMBINED or MOUSEKEY_INERTIA"
+#    endif
+
 /* max value on report descriptor */
 #    ifndef MOUSEKEY_MOVE_MAX
 #        define MOUSEKEY_MOVE_MAX 127
@@ -45,6 +45,10 @@
 #    include "connection.h"
 #endif
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    include "pointing_device.h"
+#endif
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
@@ -209,6 +213,15 @@ void nvm_eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+void nvm_eeconfig_read_pointing_device_accel(pointing_device_accel_config_t *config) {
+    eeprom_read_block(config, EECONFIG_POINTING_DEVICE_ACCEL, sizeof(pointing_device_accel_config_t));
+}
+void nvm_eeconfig_update_pointing_device_accel(const pointing_device_accel_config_t *config) {
+    eeprom_update_block(config, EECONFIG_POINTING_DEVICE_ACCEL, sizeof(pointing_device_accel_config_t));
+}
+#endif // POINTING_DEVICE_ACCEL_ENABLE
+
 bool nvm_eeconfig_read_handedness(void) {
     return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
 }
@@ -30,6 +30,10 @@ typedef struct PACKED {
     uint32_t haptic;
     uint8_t  rgblight_ext;
     uint8_t  connection;
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    // Only reserved when enabled, so the layout of keyboards without pointer acceleration is unchanged
+    uint8_t pointing_device_accel[5];
+#endif
 } eeprom_core_t;
 
 /* EEPROM parameter address */
@@ -50,6 +54,9 @@ typedef struct PACKED {
 #define EECONFIG_HAPTIC (uint32_t *)(offsetof(eeprom_core_t, haptic))
 #define EECONFIG_RGBLIGHT_EXTENDED (uint8_t *)(offsetof(eeprom_core_t, rgblight_ext))
 #define EECONFIG_CONNECTION (uint8_t *)(offsetof(eeprom_core_t, connection))
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    define EECONFIG_POINTING_DEVICE_ACCEL (uint8_t *)(offsetof(eeprom_core_t, pointing_device_accel))
+#endif
 
 // Size of EEPROM being used for core data storage
 #define EECONFIG_BASE_SIZE ((uint8_t)sizeof(eeprom_core_t))
@@ -93,6 +93,12 @@ void                              nvm_eeconfig_read_connection(connection_config
 void                              nvm_eeconfig_update_connection(const connection_config_t *config);
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+typedef struct pointing_device_accel_config_t pointing_device_accel_config_t;
+void                                          nvm_eeconfig_read_pointing_device_accel(pointing_device_accel_config_t *config);
+void                                          nvm_eeconfig_update_pointing_device_accel(const pointing_device_accel_config_t *config);
+#endif // POINTING_DEVICE_ACCEL_ENABLE
+
 bool nvm_eeconfig_read_handedness(void);
 void nvm_eeconfig_update_handedness(bool val);
 
@@ -3,54 +3,78 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
 #include "timer.h"
+#include "keyboard.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
 
-typedef struct lvgl_state_t {
-    uint8_t        fnc_id; // Ideally this should be the pointer of the function to run
-    uint16_t       delay_ms;
-    deferred_token defer_token;
-} lvgl_state_t;
-
-static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_task_handler
-static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
+static deferred_executor_t lvgl_executor     = {0}; // For lv_task_handler
+static deferred_token      lvgl_defer_token  = INVALID_DEFERRED_TOKEN;
+static uint32_t            last_lvgl_tick    = 0;
+static uint32_t            last_input_seen   = 0;
+static bool                flush_in_progress = false;
 
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
+static lv_disp_drv_t disp_drv; /*Descriptor of a display driver*/
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+// Waits for the area currently being transmitted, then hands its buffer back to LVGL
+static void qp_lvgl_flush_complete(void) {
+    if (flush_in_progress) {
+        flush_in_progress = false;
+        qp_comms_stop(selected_display);
+        lv_disp_flush_ready(&disp_drv);
+    }
+}
+
+static void qp_lvgl_flush_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_complete();
+}
+
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
+        // Only one area can be on the bus at a time
+        qp_lvgl_flush_complete();
+
+        painter_driver_t *driver = (painter_driver_t *)selected_display;
+        if (!qp_comms_start(selected_display)) {
+            qp_dprintf("qp_lvgl_flush: fail (could not start comms)\n");
+            lv_disp_flush_ready(disp);
+            return;
+        }
+
+        // Comms are left open while the pixel data is transmitted, which is done asynchronously where the display's
+        // comms support it -- LVGL renders the next area into the other buffer in the meantime. The bus stays held until
+        // the task handler returns, so LVGL callbacks must not use other painter devices or SPI peripherals on this bus.
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
-        qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
-        qp_pixdata(selected_display, (void *)color_p, number_pixels);
-        qp_flush(selected_display);
-        lv_disp_flush_ready(disp);
+        driver->driver_vtable->viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+        driver->driver_vtable->pixdata(selected_display, (void *)color_p, number_pixels);
+        flush_in_progress = true;
+
+#if QP_LVGL_BUFFER_COUNT < 2
+        // LVGL renders straight back into the only buffer, so the transfer needs to complete first
+        qp_lvgl_flush_complete();
+#endif
     }
 }
 
-static uint32_t tick_task_callback(uint32_t trigger_time, void *cb_arg) {
-    lvgl_state_t *  state     = (lvgl_state_t *)cb_arg;
-    static uint32_t last_tick = 0;
-    switch (state->fnc_id) {
-        case 0: {
-            uint32_t now = timer_read32();
-            lv_tick_inc(TIMER_DIFF_32(now, last_tick));
-            last_tick = now;
-        } break;
-        case 1:
-            lv_task_handler();
-            break;
-
-        default:
-            break;
-    }
+static uint32_t lvgl_task_callback(uint32_t trigger_time, void *cb_arg) {
+    uint32_t now = timer_read32();
+    lv_tick_inc(TIMER_DIFF_32(now, last_lvgl_tick));
+    last_lvgl_tick = now;
+
+    uint32_t time_till_next = lv_task_handler();
+
+    // Rendering is complete for now, so release the display once the last area has been transmitted
+    qp_lvgl_flush_complete();
 
-    // The tasks should run indefinitely
-    return state->delay_ms;
+    // Sleep until LVGL next has work to do, such as an animation or refresh -- input activity wakes it early
+    return QP_MAX(QP_LVGL_TASK_PERIOD, QP_MIN(time_till_next, QP_LVGL_IDLE_PERIOD));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,24 +91,12 @@ bool qp_lvgl_attach(painter_device_t device) {
         return false;
     }
 
-    // Setting up the tasks
-    lvgl_state_t *lv_tick_inc_state = &lvgl_states[0];
-    lv_tick_inc_state->fnc_id       = 0;
-    lv_tick_inc_state->delay_ms     = 1;
-    lv_tick_inc_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, 1, tick_task_callback, lv_tick_inc_state);
+    // Setting up the task
+    last_lvgl_tick   = timer_read32();
+    last_input_seen  = last_input_activity_time();
+    lvgl_defer_token = defer_exec_advanced(&lvgl_executor, 1, QP_LVGL_TASK_PERIOD, lvgl_task_callback, NULL);
 
-    if (lv_tick_inc_state->defer_token == INVALID_DEFERRED_TOKEN) {
-        qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
-        qp_lvgl_detach();
-        return false;
-    }
-
-    lvgl_state_t *lv_task_handler_state = &lvgl_states[1];
-    lv_task_handler_state->fnc_id       = 1;
-    lv_task_handler_state->delay_ms     = QP_LVGL_TASK_PERIOD;
-    lv_task_handler_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, QP_LVGL_TASK_PERIOD, tick_task_callback, lv_task_handler_state);
-
-    if (lv_task_handler_state->defer_token == INVALID_DEFERRED_TOKEN) {
+    if (lvgl_defer_token == INVALID_DEFERRED_TOKEN) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
         qp_lvgl_detach();
         return false;
@@ -95,18 +107,22 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
+    // Allocate each buffer as a fraction of the screen size
+    const size_t count_required   = driver->panel_width * driver->panel_height / QP_LVGL_BUFFER_DIVISOR;
+    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * QP_LVGL_BUFFER_COUNT);
     if (!new_color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
     color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * QP_LVGL_BUFFER_COUNT);
     // Initialize the display buffer.
+#if QP_LVGL_BUFFER_COUNT > 1
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, ((lv_color_t *)color_buffer) + count_required, count_required);
+#else
     lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+#endif
 
     selected_display = device;
 
@@ -114,13 +130,13 @@ bool qp_lvgl_attach(painter_device_t device) {
     qp_get_geometry(selected_display, &panel_width, &panel_height, NULL, &offset_x, &offset_y);
 
     // Setting up display driver
-    static lv_disp_drv_t disp_drv;     /*Descriptor of a display driver*/
-    lv_disp_drv_init(&disp_drv);       /*Basic initialization*/
-    disp_drv.flush_cb = qp_lvgl_flush; /*Set your driver function*/
-    disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
-    disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
-    disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
-    lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
+    lv_disp_drv_init(&disp_drv);            /*Basic initialization*/
+    disp_drv.flush_cb = qp_lvgl_flush;      /*Set your driver function*/
+    disp_drv.wait_cb  = qp_lvgl_flush_wait; /*Called by LVGL while waiting for a buffer to be flushed*/
+    disp_drv.draw_buf = &draw_buf;          /*Assign the buffer to the display*/
+    disp_drv.hor_res  = panel_width;        /*Set the horizontal resolution of the display*/
+    disp_drv.ver_res  = panel_height;       /*Set the vertical resolution of the display*/
+    lv_disp_drv_register(&disp_drv);        /*Finally register the driver*/
 
     return true;
 }
@@ -129,8 +145,10 @@ bool qp_lvgl_attach(painter_device_t device) {
 // Quantum Painter LVGL Integration API: qp_lvgl_detach
 
 void qp_lvgl_detach(void) {
-    for (int i = 0; i < 2; ++i) {
-        cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
+    cancel_deferred_exec_advanced(&lvgl_executor, 1, lvgl_defer_token);
+    lvgl_defer_token = INVALID_DEFERRED_TOKEN;
+    if (selected_display) {
+        qp_lvgl_flush_complete();
     }
     if (color_buffer) {
         free(color_buffer);
@@ -143,6 +161,13 @@ void qp_lvgl_detach(void) {
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
+    // Run LVGL as soon as possible after any input activity, as that's when the UI is most likely to change
+    uint32_t last_input = last_input_activity_time();
+    if (last_input != last_input_seen) {
+        last_input_seen = last_input;
+        extend_deferred_exec_advanced(&lvgl_executor, 1, lvgl_defer_token, 1);
+    }
+
     static uint32_t last_lvgl_exec = 0;
-    deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+    deferred_exec_advanced_task(&lvgl_executor, 1, &last_lvgl_exec);
 }
@@ -11,6 +11,18 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+#ifndef QP_LVGL_IDLE_PERIOD
+#    define QP_LVGL_IDLE_PERIOD 100
+#endif
+
+#ifndef QP_LVGL_BUFFER_COUNT
+#    define QP_LVGL_BUFFER_COUNT 2
+#endif
+
+#ifndef QP_LVGL_BUFFER_DIVISOR
+#    define QP_LVGL_BUFFER_DIVISOR 10
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
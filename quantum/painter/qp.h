@@ -64,6 +64,15 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK
+/**
+ * @def This controls the maximum number of pixels of an animation frame that are rendered at one time. Larger frames
+ *      (or frame deltas) are split into slices of whole rows, rendered on subsequent ticks, so that large animations
+ *      don't stall the rest of the firmware such as matrix scanning. Set to 0 to always render whole frames at once.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK 0
+#endif // QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +81,24 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT
+/**
+ * @def This controls the number of pixel data buffers. With 2 buffers, pixel data is decoded into one buffer while the
+ *      other is still being transmitted, for displays whose comms support asynchronous transfers (such as SPI with DMA
+ *      on ChibiOS). Each extra buffer requires another QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT 1
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE
+/**
+ * @def This controls the size (in bytes) of the read-ahead cache used when reading images and fonts from external
+ *      flash, using \ref qp_load_image_flash and \ref qp_load_font_flash. Each cache miss reads this many bytes in a
+ *      single sequential burst. The cache is shared by all images and fonts loaded from external flash.
+ */
+#    define QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE 64
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -88,6 +115,40 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+/**
+ * @def This controls whether images compressed with QMK LZ are supported. Decoding requires a 256-byte history window
+ *      for each image being drawn, including one per concurrent animation.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION FALSE
+#endif
+
+#ifndef QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES
+/**
+ * @def This controls the number of interpolated palettes, as used when recoloring images and fonts, retained in the
+ *      display's native pixel format. Redrawing with a recently used device and color pair skips interpolating and
+ *      converting the palette. Palettes of up to 16 entries (4bpp) are cached, each costing around 80 bytes of RAM.
+ *      Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) used to cache rendered font glyphs in the display's native pixel
+ *      format. Redrawing a cached glyph with the same colors skips reading and decoding the font entirely. Least
+ *      recently used glyphs are evicted when full. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs that can be held in the glyph cache at any one time.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -353,6 +414,20 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image stored in external flash, such as one packed using `qmk painter-pack-flash`.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the address of the image data within external flash
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +515,19 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font stored in external flash, such as one packed using `qmk painter-pack-flash`.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the address of the font data within external flash
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -569,6 +657,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 #    define LD7032_NUM_DEVICES 0
 #endif // QUANTUM_PAINTER_LD7032_ENABLE
 
+#ifdef QUANTUM_PAINTER_VIRTUAL_PANEL_ENABLE
+#    include "qp_virtual_panel.h"
+#else // QUANTUM_PAINTER_VIRTUAL_PANEL_ENABLE
+#    define VIRTUAL_PANEL_NUM_DEVICES 0
+#endif // QUANTUM_PAINTER_VIRTUAL_PANEL_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Extras
 
@@ -16,6 +16,15 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous comms APIs
+//
+// Data sent asynchronously must remain unmodified until the transfer completes. Any other comms operation waits for an
+// outstanding transfer first, so commands and data always reach the device in the order they were issued.
+
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+void     qp_comms_wait(painter_device_t device);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
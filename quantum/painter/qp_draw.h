@@ -9,8 +9,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
-// Global variable used for native pixel data streaming.
-extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Global variable used for native pixel data streaming. Refers to the buffer currently being filled, which changes on
+// each call to qp_internal_pixdata_flip() when QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT is greater than 1. It is still an
+// array, so sizeof(qp_internal_global_pixdata_buffer) is QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE.
+extern uint8_t (*qp_internal_pixdata_buffer_current)[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#define qp_internal_global_pixdata_buffer (*qp_internal_pixdata_buffer_current)
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -18,6 +21,10 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 // Returns the number of pixels that can fit in the pixdata buffer
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 
+// Transmits the first native_pixel_count pixels of the current pixdata buffer, then moves on to the next buffer. The
+// transmission may still be in progress on return, in which case the transmitted buffer must not be modified.
+bool qp_internal_pixdata_flip(painter_device_t device, uint32_t native_pixel_count);
+
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
@@ -27,6 +34,39 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Accumulates the horizontal spans of filled shapes, merging vertically adjacent spans of the same extent so that they're
+// drawn as a single rect. Spans are drawn with qp_internal_fillrect_helper_impl, so the whole pixdata buffer needs filling.
+typedef struct qp_internal_span_state_t {
+    painter_device_t device;
+    bool             pending;
+    int16_t          left;
+    int16_t          top;
+    int16_t          right;
+    int16_t          bottom;
+} qp_internal_span_state_t;
+
+void qp_internal_span_init(qp_internal_span_state_t* state, painter_device_t device);
+bool qp_internal_span_add(qp_internal_span_state_t* state, int16_t y, int16_t left, int16_t right);
+bool qp_internal_span_flush(qp_internal_span_state_t* state);
+
+// Spans of filled shapes which are symmetric about their center, with the rows above and below the center accumulated
+// separately. Rows are expected in order of offset from the center, either increasing or decreasing.
+typedef struct qp_internal_symmetric_spans_t {
+    qp_internal_span_state_t above;
+    qp_internal_span_state_t below;
+    int16_t                  centerx;
+    int16_t                  centery;
+    int16_t                  widen_offsety; // -1 if no row is being widened
+    int16_t                  widen_half_width;
+} qp_internal_symmetric_spans_t;
+
+void qp_internal_symmetric_spans_init(qp_internal_symmetric_spans_t* spans, painter_device_t device, int16_t centerx, int16_t centery);
+bool qp_internal_symmetric_spans_add(qp_internal_symmetric_spans_t* spans, int16_t offsety, int16_t half_width);
+// Adds a row which may be widened by subsequent calls for the same row, as when a shape's outline is traced along its top
+// and bottom edges -- the row is only added once another row is supplied, or the spans are flushed.
+bool qp_internal_symmetric_spans_widen(qp_internal_symmetric_spans_t* spans, int16_t offsety, int16_t half_width);
+bool qp_internal_symmetric_spans_flush(qp_internal_symmetric_spans_t* spans);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -44,15 +84,24 @@ extern qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
 // Generates a color-interpolated lookup table based off the number of items, from foreground to background, for use with monochrome image rendering.
-// Returns true if a palette was created, false if the palette is reused.
-// As this uses a global, this may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() below to reset.
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+// Returns true if a palette was created and needs conversion to the device's native format, false if the palette is reused.
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Needs to be invoked if converting the lookup table to native format fails.
 void qp_internal_invalidate_palette(void);
 
+// Converts the global palette to the device's native format, invalidating it on failure. Interpolated palettes are retained in the palette cache, if enabled.
+bool qp_internal_convert_palette(painter_device_t device, int16_t palette_size);
+
+// Maximum number of entries of interpolated palettes retained in the palette cache -- i.e. up to 4bpp
+#define QP_PALETTE_CACHE_MAX_STEPS 16
+
+// Batch conversion of HSV888 palette entries to byte-swapped RGB565, for use by drivers' palette_convert implementations.
+void qp_internal_palette_convert_rgb565_swapped(qp_pixel_t* palette, int16_t palette_size);
+
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
-bool qp_internal_load_qgf_palette(qp_stream_t* stream, uint8_t bpp);
+// needs_pixconvert is set to false if the palette matches the one previously loaded for the same device, as the lookup table has already been converted.
+bool qp_internal_load_qgf_palette(painter_device_t device, qp_stream_t* stream, uint8_t bpp, bool* needs_pixconvert);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter codec functions
@@ -63,6 +112,19 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+// Matches may reference up to this many previously-decoded bytes
+#    define QP_LZ_WINDOW_SIZE 256
+#    define QP_LZ_MIN_MATCH 4
+
+enum qp_internal_lz_mode_t {
+    LZ_TOKEN,
+    LZ_LITERALS,
+    LZ_MATCH_OFFSET,
+    LZ_MATCH,
+};
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -73,6 +135,17 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        // LZ-specific
+        struct {
+            enum qp_internal_lz_mode_t mode;
+            uint32_t                   remain;     // number of bytes remaining in the current mode, may exceed 64k
+            uint8_t                    match_len;  // match length nibble of the current token
+            uint8_t                    distance;   // match distance minus one
+            uint8_t                    window_pos; // write position within the window, wraps with the window size
+            uint8_t                    window[QP_LZ_WINDOW_SIZE];
+        } lz;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
     };
 } qp_internal_byte_input_state_t;
 
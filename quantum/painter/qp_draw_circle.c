@@ -7,23 +7,18 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw circle outlines
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
     Two special cases exist and have been optimized:
     1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    equivalent, so we can omit them
+    2) offsetx == 0 (the starting point) makes half the symmetrical points
+    identical to their twins, so we only need four points
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -42,86 +37,75 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
         if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, centery)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, centery)) {
+            return false;
         }
     } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
+            return false;
         }
-
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
+            return false;
+        }
+        if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
+            return false;
         }
     }
 
     return true;
 }
 
+// Filled circles are drawn as horizontal spans, each row only once -- the points computed in the first octant give the
+// rows furthest from the center (offset offsety, spanning offsetx either side), and their reflections give the rows
+// nearest to the center (offset offsetx, spanning offsety either side). The two sets of rows are accumulated separately,
+// as each progresses away from or towards the center in order, allowing runs of identical rows to be merged.
+static bool qp_circle_fill_helper_impl(qp_internal_symmetric_spans_t *outer, qp_internal_symmetric_spans_t *inner, uint16_t offsetx, uint16_t offsety) {
+    if (!qp_internal_symmetric_spans_widen(outer, offsety, offsetx)) {
+        return false;
+    }
+
+    // The two sets of rows meet at the final point, where offsetx >= offsety. Rows nearest to the center are held back
+    // by one point so that any reaching the final offsety can be dropped, as they've been drawn by the outer rows.
+    if (offsetx >= offsety) {
+        if (inner->widen_offsety >= (int16_t)offsety) {
+            inner->widen_offsety = -1;
+        }
+        return true;
+    }
+    return qp_internal_symmetric_spans_widen(inner, offsetx, offsety);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_circle
 
@@ -138,18 +122,19 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Merged spans may cover more than a single row, so filled circles need the whole pixdata buffer filled
+    qp_internal_fill_pixdata(device, filled ? qp_internal_num_pixels_in_buffer(device) : 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
+    qp_internal_symmetric_spans_t outer, inner;
+    qp_internal_symmetric_spans_init(&outer, device, x, y);
+    qp_internal_symmetric_spans_init(&inner, device, x, y);
 
+    bool ret = filled ? qp_circle_fill_helper_impl(&outer, &inner, xcalc, ycalc) : qp_circle_helper_impl(device, x, y, xcalc, ycalc);
     if (ret) {
         while (xcalc < ycalc) {
             xcalc++;
@@ -159,13 +144,17 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
                 ycalc--;
                 err += ((xcalc - ycalc) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+            if (!(filled ? qp_circle_fill_helper_impl(&outer, &inner, xcalc, ycalc) : qp_circle_helper_impl(device, x, y, xcalc, ycalc))) {
                 ret = false;
                 break;
             }
         }
     }
 
+    if (ret && filled) {
+        ret = qp_internal_symmetric_spans_flush(&outer) && qp_internal_symmetric_spans_flush(&inner);
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
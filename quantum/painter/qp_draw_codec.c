@@ -55,10 +55,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        if (!qp_internal_convert_palette(device, steps)) {
             return false;
         }
     }
@@ -126,6 +125,85 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
+// Reads the extension bytes of a length nibble, as per LZ4 -- each 255 means another byte follows
+static inline int16_t qp_drawimage_lz_read_length(qp_stream_t* stream, uint32_t* length) {
+    int16_t c;
+    do {
+        c = qp_stream_get(stream);
+        if (c < 0) {
+            return c;
+        }
+        *length += c;
+    } while (c == 255);
+    return 0;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    while (true) {
+        switch (state->lz.mode) {
+            case LZ_TOKEN: {
+                // High nibble is the literal length, low nibble is the match length
+                int16_t token = qp_stream_get(state->src_stream);
+                if (token < 0) {
+                    return token;
+                }
+                state->lz.remain    = token >> 4;
+                state->lz.match_len = token & 0x0F;
+                if (state->lz.remain == 15 && qp_drawimage_lz_read_length(state->src_stream, &state->lz.remain) < 0) {
+                    return STREAM_EOF;
+                }
+                state->lz.mode = (state->lz.remain > 0) ? LZ_LITERALS : LZ_MATCH_OFFSET;
+                break;
+            }
+
+            case LZ_LITERALS: {
+                state->curr = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    return state->curr;
+                }
+                state->lz.window[state->lz.window_pos++] = (uint8_t)state->curr;
+                if (--state->lz.remain == 0) {
+                    // The offset is only read once more data is requested -- the final sequence has no match
+                    state->lz.mode = LZ_MATCH_OFFSET;
+                }
+                return state->curr;
+            }
+
+            case LZ_MATCH_OFFSET: {
+                int16_t distance = qp_stream_get(state->src_stream);
+                if (distance < 0) {
+                    return distance;
+                }
+                state->lz.distance = (uint8_t)distance;
+                state->lz.remain   = state->lz.match_len;
+                if (state->lz.match_len == 15 && qp_drawimage_lz_read_length(state->src_stream, &state->lz.remain) < 0) {
+                    return STREAM_EOF;
+                }
+                state->lz.remain += QP_LZ_MIN_MATCH;
+                state->lz.mode = LZ_MATCH;
+                break;
+            }
+
+            case LZ_MATCH: {
+                // Copy from the history window, which also extends the window -- overlapping matches repeat their pattern
+                uint8_t c                                = state->lz.window[(uint8_t)(state->lz.window_pos - state->lz.distance - 1)];
+                state->lz.window[state->lz.window_pos++] = c;
+                state->curr                              = c;
+                if (--state->lz.remain == 0) {
+                    state->lz.mode = LZ_TOKEN;
+                }
+                return c;
+            }
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -136,7 +214,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_pixdata_flip(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
@@ -155,8 +233,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_pixdata_flip(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -180,7 +257,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_pixdata_flip(device, output_state.pixel_write_pos);
         }
     }
 
@@ -197,7 +274,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_pixdata_flip(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
@@ -212,6 +289,13 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.mode       = LZ_TOKEN;
+            input_state->lz.remain     = 0;
+            input_state->lz.window_pos = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION
         default:
             return NULL;
     }
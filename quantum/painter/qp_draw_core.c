@@ -9,6 +9,7 @@
 #include "qgf.h"
 
 STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE % 16) == 0, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE needs to be a non-zero multiple of 16");
+STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT == 1) || (QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT == 2), "QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT needs to be 1 or 2");
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Global variables
@@ -20,8 +21,11 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
-// Buffer used for transmitting native pixel data to the downstream device.
-__attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Buffers used for transmitting native pixel data to the downstream device.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t (*qp_internal_pixdata_buffer_current)[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE] = &qp_internal_pixdata_buffers[0];
+
+STATIC_ASSERT(sizeof(qp_internal_global_pixdata_buffer) == QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE, "qp_internal_global_pixdata_buffer must remain an array");
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -34,6 +38,72 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table[16];
 #endif
 
+// Raw copy of the palette most recently loaded from an asset, so that identical palettes (such as those repeated in each
+// frame of an animation) can skip conversion to the native pixel format
+static bool                   loaded_palette         = false;
+static uint16_t               loaded_palette_entries = 0;
+static qgf_palette_entry_v1_t loaded_palette_hsv[sizeof(qp_internal_global_pixel_lookup_table) / sizeof(qp_pixel_t)];
+
+// The device whose native pixel format the lookup table was last converted to
+static painter_device_t palette_device = NULL;
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+// Interpolated palettes already converted to the native pixel format of a device, so that recoloring with a recently
+// used color pair skips interpolation and conversion
+typedef struct qp_palette_cache_entry_t {
+    painter_device_t device; // NULL if the entry is unused
+    qp_pixel_t       fg_hsv888;
+    qp_pixel_t       bg_hsv888;
+    int16_t          steps;
+    uint32_t         last_used;
+    qp_pixel_t       native[QP_PALETTE_CACHE_MAX_STEPS];
+} qp_palette_cache_entry_t;
+
+static qp_palette_cache_entry_t qp_palette_cache[QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES] = {0};
+static uint32_t                 qp_palette_cache_clock                                 = 0;
+
+static inline bool qp_palette_cache_same_color(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static qp_palette_cache_entry_t *qp_palette_cache_find(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &qp_palette_cache[i];
+        if (entry->device == device && entry->steps == steps && qp_palette_cache_same_color(entry->fg_hsv888, fg_hsv888) && qp_palette_cache_same_color(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++qp_palette_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Stores the converted lookup table, replacing the least recently used entry if full
+static void qp_palette_cache_insert(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    if (steps > QP_PALETTE_CACHE_MAX_STEPS) {
+        return;
+    }
+
+    qp_palette_cache_entry_t *slot = &qp_palette_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &qp_palette_cache[i];
+        if (entry->device == NULL) {
+            slot = entry;
+            break;
+        }
+        if (entry->last_used < slot->last_used) {
+            slot = entry;
+        }
+    }
+
+    slot->device    = device;
+    slot->fg_hsv888 = fg_hsv888;
+    slot->bg_hsv888 = bg_hsv888;
+    slot->steps     = steps;
+    slot->last_used = ++qp_palette_cache_clock;
+    memcpy(slot->native, qp_internal_global_pixel_lookup_table, steps * sizeof(qp_pixel_t));
+}
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
@@ -42,6 +112,23 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+// Transmits the current pixdata buffer, then switches to the next one
+bool qp_internal_pixdata_flip(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count)) {
+        return false;
+    }
+
+#if QUANTUM_PAINTER_PIXDATA_BUFFER_COUNT > 1
+    // The other buffer can be filled while this one is still being transmitted -- starting the next transmission waits for this one
+    qp_internal_pixdata_buffer_current = (qp_internal_pixdata_buffer_current == &qp_internal_pixdata_buffers[0]) ? &qp_internal_pixdata_buffers[1] : &qp_internal_pixdata_buffers[0];
+#else
+    // There's only one buffer, so it can't be refilled until it's been transmitted
+    qp_comms_wait(device);
+#endif
+    return true;
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -65,27 +152,41 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     }
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated, such as when conversion of the lookup table failed part-way.
+// Cached palettes are unaffected, as they're only retained once conversion succeeds.
 void qp_internal_invalidate_palette(void) {
     generated_palette = false;
     generated_steps   = -1;
+    loaded_palette    = false;
+    palette_device    = NULL;
 }
 
 // Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
-    // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    // Check if we need to generate a new palette -- if the input parameters match, and it was already converted for the
+    // same device, then assume the palette can stay unchanged.
+    if (generated_palette == true && palette_device == device && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
         // We already have the correct palette, no point regenerating it.
         return false;
     }
 
     // Save the parameters so we know whether we can skip generation
+    loaded_palette         = false;
+    palette_device         = device;
     generated_palette      = true;
     generated_steps        = steps;
     interpolated_fg_hsv888 = fg_hsv888;
     interpolated_bg_hsv888 = bg_hsv888;
 
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    // Recently used color pairs have already been converted to the device's native format
+    qp_palette_cache_entry_t *cached = qp_palette_cache_find(device, fg_hsv888, bg_hsv888, steps);
+    if (cached) {
+        memcpy(qp_internal_global_pixel_lookup_table, cached->native, steps * sizeof(qp_pixel_t));
+        return false;
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
     int16_t hue_fg = fg_hsv888.hsv888.h;
     int16_t hue_bg = bg_hsv888.hsv888.h;
 
@@ -108,8 +209,74 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     return true;
 }
 
+// Converts the global lookup table to the device's native pixel format, retaining interpolated palettes for reuse
+bool qp_internal_convert_palette(painter_device_t device, int16_t palette_size) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver->driver_vtable->palette_convert(device, palette_size, qp_internal_global_pixel_lookup_table)) {
+        qp_internal_invalidate_palette();
+        return false;
+    }
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    if (generated_palette && palette_device == device && generated_steps == palette_size) {
+        qp_palette_cache_insert(device, interpolated_fg_hsv888, interpolated_bg_hsv888, palette_size);
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    return true;
+}
+
+// Converts HSV888 palette entries to byte-swapped RGB565 in place. Matches hsv_to_rgb_nocie(), but skips conversion of
+// entries repeating the previous one, and packs directly into RGB565 rather than going through rgb_t.
+void qp_internal_palette_convert_rgb565_swapped(qp_pixel_t *palette, int16_t palette_size) {
+    uint8_t  last_h = 0, last_s = 0, last_v = 0;
+    uint16_t last_rgb565 = 0;
+    for (int16_t i = 0; i < palette_size; ++i) {
+        uint8_t h = palette[i].hsv888.h, s = palette[i].hsv888.s, v = palette[i].hsv888.v;
+        if (i > 0 && h == last_h && s == last_s && v == last_v) {
+            palette[i].rgb565 = last_rgb565;
+            continue;
+        }
+
+        uint8_t r, g, b;
+        if (s == 0) {
+            r = g = b = v;
+        } else {
+            uint8_t region    = h * 6 / 255;
+            uint8_t remainder = (h * 2 - region * 85) * 3;
+            uint8_t p         = (v * (255 - s)) >> 8;
+            uint8_t q         = (v * (255 - ((s * remainder) >> 8))) >> 8;
+            uint8_t t         = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+            switch (region) {
+                case 6:
+                case 0:
+                    r = v, g = t, b = p;
+                    break;
+                case 1:
+                    r = q, g = v, b = p;
+                    break;
+                case 2:
+                    r = p, g = v, b = t;
+                    break;
+                case 3:
+                    r = p, g = q, b = v;
+                    break;
+                case 4:
+                    r = t, g = p, b = v;
+                    break;
+                default:
+                    r = v, g = p, b = q;
+                    break;
+            }
+        }
+
+        last_h = h, last_s = s, last_v = v;
+        last_rgb565       = __builtin_bswap16((uint16_t)((r >> 3) << 11 | (g >> 2) << 5 | (b >> 3)));
+        palette[i].rgb565 = last_rgb565;
+    }
+}
+
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
-bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
+bool qp_internal_load_qgf_palette(painter_device_t device, qp_stream_t *stream, uint8_t bpp, bool *needs_pixconvert) {
     qgf_palette_v1_t palette_descriptor;
     if (qp_stream_read(&palette_descriptor, sizeof(qgf_palette_v1_t), 1, stream) != 1) {
         qp_dprintf("Failed to read palette_descriptor, expected length was not %d\n", (int)sizeof(qgf_palette_v1_t));
@@ -119,7 +286,10 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
     // BPP determines the number of palette entries, each entry is a HSV888 triplet.
     const uint16_t palette_entries = 1u << bpp;
 
-    // Ensure we aren't reusing any palette
+    // If this is the same palette as the one previously loaded for this device, the lookup table is already converted
+    bool reuse = loaded_palette && palette_device == device && loaded_palette_entries == palette_entries;
+
+    // Ensure we aren't reusing any palette if reading fails part-way
     qp_internal_invalidate_palette();
 
     // Read the palette entries
@@ -130,14 +300,31 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
             return false;
         }
 
+        // On the first difference, the entries skipped so far need restoring as the lookup table holds converted pixels
+        if (reuse && memcmp(&entry, &loaded_palette_hsv[i], sizeof(qgf_palette_entry_v1_t)) != 0) {
+            for (uint16_t j = 0; j < i; ++j) {
+                qp_internal_global_pixel_lookup_table[j].hsv888.h = loaded_palette_hsv[j].h;
+                qp_internal_global_pixel_lookup_table[j].hsv888.s = loaded_palette_hsv[j].s;
+                qp_internal_global_pixel_lookup_table[j].hsv888.v = loaded_palette_hsv[j].v;
+            }
+            reuse = false;
+        }
+        loaded_palette_hsv[i] = entry;
+
         // Update the lookup table
-        qp_internal_global_pixel_lookup_table[i].hsv888.h = entry.h;
-        qp_internal_global_pixel_lookup_table[i].hsv888.s = entry.s;
-        qp_internal_global_pixel_lookup_table[i].hsv888.v = entry.v;
+        if (!reuse) {
+            qp_internal_global_pixel_lookup_table[i].hsv888.h = entry.h;
+            qp_internal_global_pixel_lookup_table[i].hsv888.s = entry.s;
+            qp_internal_global_pixel_lookup_table[i].hsv888.v = entry.v;
+        }
 
-        qp_dprintf("qp_internal_load_qgf_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)palette_entries, (int)qp_internal_global_pixel_lookup_table[i].hsv888.h, (int)qp_internal_global_pixel_lookup_table[i].hsv888.s, (int)qp_internal_global_pixel_lookup_table[i].hsv888.v);
+        qp_dprintf("qp_internal_load_qgf_palette: %3d of %d -- H: %3d, S: %3d, V: %3d\n", (int)(i + 1), (int)palette_entries, (int)entry.h, (int)entry.s, (int)entry.v);
     }
 
+    loaded_palette         = true;
+    loaded_palette_entries = palette_entries;
+    palette_device         = device;
+    *needs_pixconvert      = !reuse;
     return true;
 }
 
@@ -251,6 +438,87 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+void qp_internal_span_init(qp_internal_span_state_t *state, painter_device_t device) {
+    state->device  = device;
+    state->pending = false;
+}
+
+bool qp_internal_span_flush(qp_internal_span_state_t *state) {
+    if (!state->pending) {
+        return true;
+    }
+    state->pending = false;
+    return qp_internal_fillrect_helper_impl(state->device, state->left, state->top, state->right, state->bottom);
+}
+
+bool qp_internal_span_add(qp_internal_span_state_t *state, int16_t y, int16_t left, int16_t right) {
+    if (state->pending && state->left == left && state->right == right) {
+        // Rows already covered don't need drawing again
+        if (y >= state->top && y <= state->bottom) {
+            return true;
+        }
+
+        // Extend the pending rect if this row is directly above or below it
+        if (y == state->top - 1) {
+            state->top = y;
+            return true;
+        }
+        if (y == state->bottom + 1) {
+            state->bottom = y;
+            return true;
+        }
+    }
+
+    if (!qp_internal_span_flush(state)) {
+        return false;
+    }
+
+    state->pending = true;
+    state->left    = left;
+    state->top     = y;
+    state->right   = right;
+    state->bottom  = y;
+    return true;
+}
+
+void qp_internal_symmetric_spans_init(qp_internal_symmetric_spans_t *spans, painter_device_t device, int16_t centerx, int16_t centery) {
+    qp_internal_span_init(&spans->above, device);
+    qp_internal_span_init(&spans->below, device);
+    spans->centerx       = centerx;
+    spans->centery       = centery;
+    spans->widen_offsety = -1;
+}
+
+bool qp_internal_symmetric_spans_add(qp_internal_symmetric_spans_t *spans, int16_t offsety, int16_t half_width) {
+    int16_t left  = spans->centerx - half_width;
+    int16_t right = spans->centerx + half_width;
+    if (!qp_internal_span_add(&spans->above, spans->centery - offsety, left, right)) {
+        return false;
+    }
+    // The center row is only drawn once
+    return offsety == 0 || qp_internal_span_add(&spans->below, spans->centery + offsety, left, right);
+}
+
+bool qp_internal_symmetric_spans_widen(qp_internal_symmetric_spans_t *spans, int16_t offsety, int16_t half_width) {
+    if (offsety != spans->widen_offsety) {
+        if (spans->widen_offsety >= 0 && !qp_internal_symmetric_spans_add(spans, spans->widen_offsety, spans->widen_half_width)) {
+            return false;
+        }
+        spans->widen_offsety    = offsety;
+        spans->widen_half_width = half_width;
+    }
+    spans->widen_half_width = QP_MAX(spans->widen_half_width, half_width);
+    return true;
+}
+
+bool qp_internal_symmetric_spans_flush(qp_internal_symmetric_spans_t *spans) {
+    if (spans->widen_offsety >= 0 && !qp_internal_symmetric_spans_add(spans, spans->widen_offsety, spans->widen_half_width)) {
+        return false;
+    }
+    spans->widen_offsety = -1;
+    return qp_internal_span_flush(&spans->above) && qp_internal_span_flush(&spans->below);
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -6,17 +6,14 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw an ellipse outline
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    When offsetx == 0 only two pixels can be drawn
     */
 
     int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
@@ -24,33 +21,20 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
     int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
 
+    if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
+        return false;
+    }
+    if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
+        return false;
+    }
     if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
-        }
+        return true;
+    }
+    if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+        return false;
+    }
+    if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+        return false;
     }
 
     return true;
@@ -75,16 +59,23 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    // Merged spans may cover more than a single row, so filled ellipses need the whole pixdata buffer filled
+    qp_internal_fill_pixdata(device, filled ? qp_internal_num_pixels_in_buffer(device) : 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
+    // Filled ellipses are drawn as horizontal spans, each row only once -- the first region traces the top and bottom
+    // edges, widening each row until moving on to the next, while the second region traces the sides a row at a time
+    qp_internal_symmetric_spans_t outer, inner;
+    qp_internal_symmetric_spans_init(&outer, device, x, y);
+    qp_internal_symmetric_spans_init(&inner, device, x, y);
+
     bool ret = true;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!(filled ? qp_internal_symmetric_spans_widen(&outer, dy, dx) : qp_ellipse_helper_impl(device, x, y, dx, dy))) {
             ret = false;
             break;
         }
@@ -98,8 +89,8 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     dx = sizex;
     dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
+        if (!(filled ? qp_internal_symmetric_spans_add(&inner, dy, dx) : qp_ellipse_helper_impl(device, x, y, dx, dy))) {
             ret = false;
             break;
         }
@@ -110,6 +101,10 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         delta += aa * (4 * dy + 6);
     }
 
+    if (ret && filled) {
+        ret = qp_internal_symmetric_spans_flush(&outer) && qp_internal_symmetric_spans_flush(&inner);
+    }
+
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
@@ -16,6 +16,9 @@ typedef struct qgf_image_handle_t {
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
@@ -85,6 +88,31 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->flash_stream = qp_make_flash_stream(address, sizeof(qgf_graphics_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    image->flash_stream.length   = qgf_get_total_size(&image->stream);
+    image->flash_stream.position = 0;
+    image->flash_stream.is_eof   = false;
+
+    return image->flash_stream.length > 0;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t address) {
+    return qp_load_image_internal(image_flash_stream_factory, &address);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -125,8 +153,6 @@ typedef struct qgf_frame_info_t {
 } qgf_frame_info_t;
 
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!info) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -148,9 +174,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Ensure we aren't reusing any palette
-    qp_internal_invalidate_palette();
-
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
         qp_comms_stop(device);
@@ -161,22 +184,20 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     const uint16_t palette_entries  = 1u << info->bpp;
     bool           needs_pixconvert = false;
     if (info->has_palette) {
-        // Load the palette from the stream
-        if (!qp_internal_load_qgf_palette((qp_stream_t *)&qgf_image->stream, info->bpp)) {
+        // Load the palette from the stream -- animation frames generally repeat the same palette, which won't need converting again
+        if (!qp_internal_load_qgf_palette(device, (qp_stream_t *)&qgf_image->stream, info->bpp, &needs_pixconvert)) {
             return false;
         }
-
-        needs_pixconvert = true;
     } else {
         if (info->bpp <= 8) {
             // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
+            needs_pixconvert = qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries);
         }
     }
 
     if (needs_pixconvert) {
         // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+        if (!qp_internal_convert_palette(device, palette_entries)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
@@ -208,7 +229,35 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+// Progress through a frame that's rendered across multiple invocations
+typedef struct qgf_frame_progress_t {
+    uint16_t                        rows_done;   // Number of rows of the frame (or delta) already rendered, zero if not yet started
+    uint16_t                        slice_delay; // Time already spent waiting between slices of this frame
+    uint32_t                        stream_pos;  // Stream position of the next pixel data to be decoded
+    qp_internal_byte_input_callback input_callback;
+    qp_internal_byte_input_state_t  input_state;
+} qgf_frame_progress_t;
+
+// Works out how many rows of a frame can be rendered in one go without exceeding QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK
+static uint16_t qp_drawimage_rows_per_slice(uint16_t width, uint8_t bpp) {
+#if QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK > 0
+    uint32_t rows = QP_MAX(1, (QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK) / width);
+
+    // Packed pixels can't be split between slices, so each slice needs to end on a byte boundary
+    if (bpp < 8) {
+        const uint8_t pixels_per_byte = 8 / bpp;
+        while (((rows * width) % pixels_per_byte) != 0) {
+            ++rows;
+        }
+    }
+
+    return (uint16_t)QP_MIN(rows, UINT16_MAX);
+#else
+    return UINT16_MAX;
+#endif // QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK > 0
+}
+
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_progress_t *progress) {
     qp_dprintf("qp_drawimage_recolor: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
@@ -245,26 +294,52 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         r = x + image->width - 1;
         b = y + image->height - 1;
     }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
+    // Without progress tracking, the whole frame is rendered in one go
+    qgf_frame_progress_t local_progress = {0};
+    uint16_t             slice_rows     = UINT16_MAX;
+    if (progress) {
+        slice_rows = qp_drawimage_rows_per_slice(r - l + 1, frame_info->bpp);
+    } else {
+        progress = &local_progress;
+    }
+
+    if (progress->rows_done == 0) {
+        // Set up the input state
+        progress->input_state    = (qp_internal_byte_input_state_t){.device = device, .src_stream = &qgf_image->stream};
+        progress->input_callback = qp_internal_prepare_input_state(&progress->input_state, frame_info->compression_scheme);
+        if (progress->input_callback == NULL) {
+            qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
+            qp_comms_stop(device);
+            return false;
+        }
+    } else {
+        // Resume decoding where the previous slice left off
+        qp_stream_setpos(&qgf_image->stream, progress->stream_pos);
     }
 
-    // Set up the input state
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
-    if (input_callback == NULL) {
-        qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
+    // Only the rows within this slice are sent to the display
+    uint16_t first_row = t + progress->rows_done;
+    uint16_t last_row  = (uint16_t)QP_MIN((uint32_t)first_row + slice_rows - 1, b);
+
+    // Configure where we're going to be rendering to
+    if (!driver->driver_vtable->viewport(device, l, first_row, r, last_row)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
         qp_comms_stop(device);
         return false;
     }
 
     // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (last_row - first_row + 1);
+    bool     ret         = qp_internal_appender(device, frame_info->bpp, pixel_count, progress->input_callback, &progress->input_state);
+
+    // Keep track of where the next slice starts, or reset once the frame is complete
+    if (ret && last_row < b) {
+        progress->rows_done += last_row - first_row + 1;
+        progress->stream_pos = qp_stream_tell(&qgf_image->stream);
+    } else {
+        progress->rows_done = 0;
+    }
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -275,7 +350,7 @@ bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, paint
     qgf_frame_info_t frame_info = {0};
     qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888, NULL);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -296,6 +371,7 @@ typedef struct animation_state_t {
     qp_pixel_t             fg_hsv888;
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
+    qgf_frame_progress_t   progress;
     deferred_token         defer_token;
 } animation_state_t;
 
@@ -305,13 +381,24 @@ static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATION
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
-    if (ret) {
+    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, &state->progress);
+    if (ret && state->progress.rows_done > 0) {
+        // Frame is partially rendered, come back for the next slice as soon as possible
+        *delay_ms = 1;
+        ++state->progress.slice_delay;
+    } else if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
             state->frame_number = 0;
         }
-        *delay_ms = frame_info.delay;
+
+        // Time spent between slices counts towards the frame's delay
+        if (frame_info.delay > state->progress.slice_delay) {
+            *delay_ms = frame_info.delay - state->progress.slice_delay;
+        } else {
+            *delay_ms = QP_MIN(frame_info.delay, 1);
+        }
+        state->progress.slice_delay = 0;
     }
     qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)(*delay_ms));
     return ret;
@@ -353,6 +440,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
     anim_state->frame_number = 0;
+    anim_state->progress     = (qgf_frame_progress_t){0};
 
     // Draw the first frame
     uint16_t delay_ms;
@@ -24,6 +24,9 @@ typedef struct qff_font_handle_t {
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
@@ -36,6 +39,147 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+STATIC_ASSERT(QUANTUM_PAINTER_GLYPH_CACHE_SIZE <= UINT16_MAX, "QUANTUM_PAINTER_GLYPH_CACHE_SIZE must fit within 16 bits");
+
+// Glyph cache entries hold already-rendered glyphs in the display's native pixel format, so redraws can be sent directly
+typedef struct qp_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if this entry is unused
+    painter_device_t   device;
+    uint32_t           code_point;
+    qp_pixel_t         fg_hsv888;
+    qp_pixel_t         bg_hsv888;
+    uint32_t           last_used;
+    uint16_t           offset; // Offset of the rendered glyph within qp_glyph_cache_data
+    uint16_t           length; // Number of bytes reserved within qp_glyph_cache_data, always a multiple of 4
+    uint8_t            width;
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t                 qp_glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static __attribute__((__aligned__(4))) uint8_t qp_glyph_cache_data[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+static uint32_t                               qp_glyph_cache_clock = 0;
+
+static inline bool qp_glyph_cache_same_color(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+// Finds the cached glyph matching the supplied parameters, or NULL if it isn't cached
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &qp_glyph_cache[i];
+        if (entry->font == qff_font && entry->device == device && entry->code_point == code_point && qp_glyph_cache_same_color(entry->fg_hsv888, fg_hsv888) && qp_glyph_cache_same_color(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++qp_glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Finds the width of a cached glyph regardless of the device or colors it was rendered with, returning false if it isn't cached
+static bool qp_glyph_cache_find_width(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &qp_glyph_cache[i];
+        if (entry->font == qff_font && entry->code_point == code_point) {
+            *width = entry->width;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Moves all cached glyphs to the start of the data area, returning the offset of the first free byte
+static uint16_t qp_glyph_cache_compact(void) {
+    uint16_t pos = 0;
+    while (true) {
+        // Find the lowest entry that hasn't been moved yet
+        qp_glyph_cache_entry_t *next = NULL;
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            qp_glyph_cache_entry_t *entry = &qp_glyph_cache[i];
+            if (entry->font && entry->offset >= pos && (!next || entry->offset < next->offset)) {
+                next = entry;
+            }
+        }
+        if (!next) {
+            return pos;
+        }
+
+        if (next->offset != pos) {
+            memmove(&qp_glyph_cache_data[pos], &qp_glyph_cache_data[next->offset], next->length);
+            next->offset = pos;
+        }
+        pos += next->length;
+    }
+}
+
+// Copies a glyph that was just rendered into the supplied pixdata buffer into the cache, evicting the least recently used glyphs as required
+static void qp_glyph_cache_insert(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t width, const uint8_t *pixdata, uint32_t byte_count) {
+    uint32_t length = (byte_count + 3) & ~3u;
+    if (length == 0 || length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        return;
+    }
+
+    // Evict until there's both a free entry and enough space for the glyph
+    qp_glyph_cache_entry_t *slot;
+    uint16_t                end;
+    while (true) {
+        qp_glyph_cache_entry_t *lru  = NULL;
+        uint32_t                used = 0;
+        slot                         = NULL;
+        end                          = 0;
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            qp_glyph_cache_entry_t *entry = &qp_glyph_cache[i];
+            if (!entry->font) {
+                if (!slot) {
+                    slot = entry;
+                }
+                continue;
+            }
+            used += entry->length;
+            if (end < entry->offset + entry->length) {
+                end = entry->offset + entry->length;
+            }
+            if (!lru || entry->last_used < lru->last_used) {
+                lru = entry;
+            }
+        }
+        if (slot && used + length <= QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+            break;
+        }
+        lru->font = NULL;
+    }
+
+    // Close up any gaps left by evictions if the glyph doesn't fit at the end
+    if (end + length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        end = qp_glyph_cache_compact();
+    }
+
+    memcpy(&qp_glyph_cache_data[end], pixdata, byte_count);
+    slot->font       = qff_font;
+    slot->device     = device;
+    slot->code_point = code_point;
+    slot->fg_hsv888  = fg_hsv888;
+    slot->bg_hsv888  = bg_hsv888;
+    slot->last_used  = ++qp_glyph_cache_clock;
+    slot->offset     = end;
+    slot->length     = length;
+    slot->width      = width;
+}
+
+// Drops all cached glyphs for the supplied font
+static void qp_glyph_cache_evict_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (qp_glyph_cache[i].font == qff_font) {
+            qp_glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,21 +217,27 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Work out the length of the font, regardless of where it's stored
+    qp_stream_seek(&font->stream, 0, SEEK_END);
+    int32_t length = qp_stream_tell(&font->stream);
+    qp_stream_setpos(&font->stream, 0);
+
+    void *ram_buffer = malloc(length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            if (qp_stream_read(ram_buffer, 1, length, &font->stream) != length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
+                qp_stream_setpos(&font->stream, 0);
                 break;
             }
 
             // Create the new stream with the new buffer
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, length);
         } while (0);
     }
 
@@ -100,6 +250,13 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     // Read the info (parsing already successful above, no need to check return value)
     qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
 
+    // QFF glyphs are decoded independently of each other, which LZ compression doesn't allow for
+    if (font->compression_scheme != IMAGE_UNCOMPRESSED && font->compression_scheme != IMAGE_COMPRESSED_RLE) {
+        qp_dprintf("qp_load_font: fail (unsupported font compression scheme (%d))\n", (int)font->compression_scheme);
+        qp_close_font((painter_font_handle_t)font);
+        return NULL;
+    }
+
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)font->bpp);
         qp_close_font((painter_font_handle_t)font);
@@ -132,6 +289,31 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the font descriptor
+    font->flash_stream = qp_make_flash_stream(address, sizeof(qff_font_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    font->flash_stream.length   = qff_get_total_size(&font->stream);
+    font->flash_stream.position = 0;
+    font->flash_stream.is_eof   = false;
+
+    return font->flash_stream.length > 0;
+}
+
+painter_font_handle_t qp_load_font_flash(uint32_t address) {
+    return qp_load_font_internal(font_flash_stream_factory, &address);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +333,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Any cached glyphs are no longer valid
+    qp_glyph_cache_evict_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -161,12 +348,10 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
-    painter_driver_t *driver = (painter_driver_t *)device;
-
     // Drop out if we can't actually place the data we read out anywhere
     if (!data_offset) {
         qp_dprintf("Failed to prepare stream for read, output info buffer unavailable\n");
@@ -188,22 +373,21 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     if (qff_font->has_palette) {
         // If this font has a palette, we need to read it out and set up the pixel lookup table
         qp_stream_setpos(&qff_font->stream, offset);
-        if (!qp_internal_load_qgf_palette(&qff_font->stream, qff_font->bpp)) {
+        if (!qp_internal_load_qgf_palette(device, &qff_font->stream, qff_font->bpp, &needs_pixconvert)) {
             return false;
         }
 
         // Skip this block, as far as offset calculations go
         offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
-        needs_pixconvert = true;
     } else {
         // Interpolate from fg/bg
         int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
+        needs_pixconvert        = qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries);
     }
 
     if (needs_pixconvert) {
         // Convert the palette to native format
-        if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
+        if (!qp_internal_convert_palette(device, palette_entries)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
             qp_comms_stop(device);
             return false;
@@ -214,6 +398,26 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+// Helper that positions the stream at the start of a glyph's pixel data
+static inline bool qp_drawtext_seek_glyph_data(qff_font_handle_t *qff_font, uint32_t glyph_value, uint8_t *width) {
+    uint8_t  glyph_width  = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    uint32_t glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+                           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+                           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                           + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+                           + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = glyph_width;
+    return true;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
@@ -231,57 +435,35 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_info.value, width);
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
         uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
                                      + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
                                      + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
+        // The unicode table is sorted by code point (enforced during validation), so binary search it
+        uint16_t lo = 0;
+        uint16_t hi = qff_font->num_unicode_glyphs;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (qp_stream_setpos(&qff_font->stream, glyph_info_offset + mid * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while preparing glyph data\n");
+                return false;
+            }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+            qff_unicode_glyph_v1_t glyph_info;
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
             if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
+                return qp_drawtext_seek_glyph_data(qff_font, glyph_info.value, width);
+            } else if (glyph_info.code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
             }
         }
 
@@ -302,13 +484,7 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
-            qp_dprintf("Failed to prepare glyph for rendering.\n");
-            return false;
-        }
-
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -325,9 +501,21 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
+    uint8_t width;
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Cached glyphs already know their width
+    if (!qp_glyph_cache_find_width(qff_font, code_point, &width))
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    {
+        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+            qp_dprintf("Failed to prepare glyph for rendering.\n");
+            return false;
+        }
+    }
+
     // Increment the overall width by this glyph's width
     state->width += width;
 
@@ -342,17 +530,48 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
+    bool                              font_prepared;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t *                 driver = (painter_driver_t *)state->device;
+    uint8_t                            height = qff_font->base.line_height;
+    uint8_t                            width;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // If the glyph has already been rendered with these colors, send it as-is
+    qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888);
+    if (entry) {
+        width = entry->width;
+        driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+        state->xpos += width;
+        return driver->driver_vtable->pixdata(state->device, &qp_glyph_cache_data[entry->offset], ((uint32_t)width) * height);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    // Set up the palette the first time a glyph actually needs decoding
+    if (!state->font_prepared) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            qp_dprintf("Failed to prepare font for rendering.\n");
+            return false;
+        }
+        state->font_prepared = true;
+    }
+
+    if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        qp_dprintf("Failed to prepare glyph for rendering.\n");
+        return false;
+    }
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
+    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_drawtext_prepare_glyph_for_render()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
     // Reset the output state
@@ -364,9 +583,25 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     // Move the x-position for the next glyph
     state->xpos += width;
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // The pixdata buffer may have moved on by the time the glyph has been sent, so keep track of where it was rendered
+    uint8_t *pixdata = qp_internal_global_pixdata_buffer;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+    if (!qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state)) {
+        return false;
+    }
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // If the whole glyph fit within the pixdata buffer, it's still there in native format -- keep a copy for next time
+    if (pixel_count <= state->output_state->max_pixels) {
+        qp_glyph_cache_insert(state->device, qff_font, code_point, state->fg_hsv888, state->bg_hsv888, width, pixdata, (pixel_count * driver->native_bits_per_pixel + 7) / 8);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,26 +663,28 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Set up the pixel output state
     qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
-    // Set up the codepoint iteration state
+    // Colors only affect the output if they're used to interpolate the palette
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    if (qff_font->has_palette || qff_font->bpp > 8) {
+        fg_hsv888.hsv888.h = fg_hsv888.hsv888.s = fg_hsv888.hsv888.v = 0;
+        bg_hsv888.hsv888.h = bg_hsv888.hsv888.s = bg_hsv888.hsv888.v = 0;
+    }
+
+    // Set up the codepoint iteration state -- the font is prepared for rendering on the first glyph that isn't cached
     code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
+                                               .device        = device,
+                                               .xpos          = x,
+                                               .ypos          = y,
+                                               .fg_hsv888     = fg_hsv888,
+                                               .bg_hsv888     = bg_hsv888,
+                                               .font_prepared = false,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
 
@@ -11,18 +11,19 @@
 enum {
     // Work out how many devices we're actually going to be instantiating
     // NOTE: We intentionally do not include surfaces here, despite them conforming to the same API.
-    QP_NUM_DEVICES = (ILI9163_NUM_DEVICES)   // ILI9163
-                     + (ILI9341_NUM_DEVICES) // ILI9341
-                     + (ILI9486_NUM_DEVICES) // ILI9486
-                     + (ILI9488_NUM_DEVICES) // ILI9488
-                     + (ST7789_NUM_DEVICES)  // ST7789
-                     + (ST7735_NUM_DEVICES)  // ST7735
-                     + (GC9A01_NUM_DEVICES)  // GC9A01
-                     + (GC9107_NUM_DEVICES)  // GC9107
-                     + (SSD1351_NUM_DEVICES) // SSD1351
-                     + (SH1106_NUM_DEVICES)  // SH1106
-                     + (SH1107_NUM_DEVICES)  // SH1107
-                     + (LD7032_NUM_DEVICES)  // LD7032
+    QP_NUM_DEVICES = (ILI9163_NUM_DEVICES)         // ILI9163
+                     + (ILI9341_NUM_DEVICES)       // ILI9341
+                     + (ILI9486_NUM_DEVICES)       // ILI9486
+                     + (ILI9488_NUM_DEVICES)       // ILI9488
+                     + (ST7789_NUM_DEVICES)        // ST7789
+                     + (ST7735_NUM_DEVICES)        // ST7735
+                     + (GC9A01_NUM_DEVICES)        // GC9A01
+                     + (GC9107_NUM_DEVICES)        // GC9107
+                     + (SSD1351_NUM_DEVICES)       // SSD1351
+                     + (SH1106_NUM_DEVICES)        // SH1106
+                     + (SH1107_NUM_DEVICES)        // SH1107
+                     + (LD7032_NUM_DEVICES)        // LD7032
+                     + (VIRTUAL_PANEL_NUM_DEVICES) // Virtual panel
 };
 
 static painter_device_t qp_devices[QP_NUM_DEVICES] = {NULL};
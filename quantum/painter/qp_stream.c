@@ -9,6 +9,11 @@
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
+    // Offload to the stream's bulk read, if it has one
+    if (stream->read) {
+        return stream->read(stream, output_ptr, num_members * member_size) / member_size;
+    }
+
     uint32_t i;
     for (i = 0; i < (num_members * member_size); ++i) {
         int16_t c = qp_stream_get(stream);
@@ -119,6 +124,158 @@ qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     return stream;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef FLASH_ENABLE
+
+#    include <string.h>
+#    include "flash.h"
+
+// Read-ahead cache, shared by all flash streams and keyed by absolute flash address
+static struct {
+    uint32_t address;
+    uint32_t length;
+    uint8_t  data[QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE];
+} flash_cache = {0};
+
+void qp_flash_stream_invalidate_cache(void) {
+    flash_cache.length = 0;
+}
+
+static inline bool flash_cache_contains(uint32_t address) {
+    return address >= flash_cache.address && address < flash_cache.address + flash_cache.length;
+}
+
+static bool flash_cache_fill(qp_flash_stream_t *s, uint32_t address) {
+    // Read ahead as much as possible in one burst, without going past the end of the stream
+    uint32_t end    = s->address + s->length;
+    uint32_t length = QP_MIN(end - address, QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE);
+    if (flash_read_range(address, flash_cache.data, length) != FLASH_STATUS_SUCCESS) {
+        qp_flash_stream_invalidate_cache();
+        return false;
+    }
+    flash_cache.address = address;
+    flash_cache.length  = length;
+    return true;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    uint32_t address = s->address + s->position;
+    if (!flash_cache_contains(address) && !flash_cache_fill(s, address)) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    s->position++;
+    return flash_cache.data[address - flash_cache.address];
+}
+
+static inline uint32_t flash_read(qp_stream_t *stream, uint8_t *output_buf, uint32_t length) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Clamp to the end of the stream
+    uint32_t remaining = (s->position < s->length) ? (uint32_t)(s->length - s->position) : 0;
+    if (length > remaining) {
+        length    = remaining;
+        s->is_eof = true;
+    }
+
+    uint32_t count = 0;
+    while (count < length) {
+        uint32_t address = s->address + s->position;
+        uint32_t chunk;
+        if (flash_cache_contains(address)) {
+            // Copy out whatever's already cached
+            chunk = QP_MIN(length - count, flash_cache.address + flash_cache.length - address);
+            memcpy(&output_buf[count], &flash_cache.data[address - flash_cache.address], chunk);
+        } else if (length - count >= QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE) {
+            // Large reads bypass the cache, going directly to the output in a single burst
+            chunk = length - count;
+            if (flash_read_range(address, &output_buf[count], chunk) != FLASH_STATUS_SUCCESS) {
+                s->is_eof = true;
+                break;
+            }
+        } else {
+            if (!flash_cache_fill(s, address)) {
+                s->is_eof = true;
+                break;
+            }
+            continue;
+        }
+        count += chunk;
+        s->position += chunk;
+    }
+
+    return count;
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Flash streams are read-only.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds as memory streams
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close, .read = flash_read},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
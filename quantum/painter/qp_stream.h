@@ -55,6 +55,9 @@ typedef struct qp_stream_t {
     int32_t (*tell)(qp_stream_t *stream);
     bool (*is_eof)(qp_stream_t *stream);
     void (*close)(qp_stream_t *stream);
+
+    // Optional bulk read, falls back to repeated get() if not supplied
+    uint32_t (*read)(qp_stream_t *stream, uint8_t *output_buf, uint32_t length);
 } qp_stream_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +73,26 @@ typedef struct qp_memory_stream_t {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef FLASH_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+// Drops any data held in the flash read-ahead cache, required if the external flash is rewritten while assets are loaded
+void qp_flash_stream_invalidate_cache(void);
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FILE streams
 
@@ -0,0 +1,246 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <functional>
+#include <map>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_draw.h"
+void qp_internal_task(void);
+void advance_time(uint32_t ms);
+}
+
+// Geometry of the virtual panel used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 64>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+// Geometry and placement of the test animation
+using ANIM_SIZE = std::integral_constant<std::uint16_t, 16>;
+using ANIM_X    = std::integral_constant<std::uint16_t, 8>;
+using ANIM_Y    = std::integral_constant<std::uint16_t, 8>;
+
+// Rows of the animation rendered per tick, given QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK
+using SLICE_ROWS = std::integral_constant<std::uint16_t, (QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK) / ANIM_SIZE::value>;
+
+struct TestFrame {
+    std::vector<std::array<std::uint8_t, 3>> palette; // HSV888
+    std::uint16_t                            left, top, right, bottom;
+    bool                                     is_delta;
+    std::uint16_t                            delay;
+    std::function<std::uint8_t(int, int)>    index; // palette index at the supplied frame-relative location
+};
+
+// Builds an uncompressed PALETTE_2BPP QGF animation
+static std::vector<std::uint8_t> make_animation(const std::vector<TestFrame>& frames) {
+    std::vector<std::uint8_t> qgf;
+    auto                      put = [&qgf](std::uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            qgf.push_back((std::uint8_t)(value >> (8 * i)));
+        }
+    };
+
+    // Graphics descriptor, total size is filled in later
+    put(0x00, 1), put(0xFF, 1), put(18, 3);
+    put(0x464751, 3), put(0x01, 1), put(0, 4), put(0, 4);
+    put(ANIM_SIZE::value, 2), put(ANIM_SIZE::value, 2), put(frames.size(), 2);
+
+    // Frame offsets, filled in later
+    put(0x01, 1), put(0xFE, 1), put(frames.size() * 4, 3);
+    const std::size_t offsets_pos = qgf.size();
+    put(0, 4 * frames.size());
+
+    for (std::size_t f = 0; f < frames.size(); ++f) {
+        const TestFrame& frame = frames[f];
+        for (int i = 0; i < 4; ++i) {
+            qgf[offsets_pos + f * 4 + i] = (std::uint8_t)(qgf.size() >> (8 * i));
+        }
+
+        // Frame descriptor
+        put(0x02, 1), put(0xFD, 1), put(6, 3);
+        put(PALETTE_2BPP, 1), put(frame.is_delta ? 0x02 : 0x00, 1), put(IMAGE_UNCOMPRESSED, 1), put(0xFF, 1), put(frame.delay, 2);
+
+        // Palette
+        put(0x03, 1), put(0xFC, 1), put(4 * 3, 3);
+        for (auto& entry : frame.palette) {
+            put(entry[0], 1), put(entry[1], 1), put(entry[2], 1);
+        }
+
+        // Delta
+        if (frame.is_delta) {
+            put(0x04, 1), put(0xFB, 1), put(8, 3);
+            put(frame.left, 2), put(frame.top, 2), put(frame.right, 2), put(frame.bottom, 2);
+        }
+
+        // Pixel data, packed 4 pixels per byte starting from the least significant bits
+        std::vector<std::uint8_t> data;
+        int                       n = 0;
+        for (int y = frame.top; y <= frame.bottom; ++y) {
+            for (int x = frame.left; x <= frame.right; ++x, ++n) {
+                if (n % 4 == 0) {
+                    data.push_back(0);
+                }
+                data.back() |= frame.index(x, y) << (2 * (n % 4));
+            }
+        }
+        put(0x05, 1), put(0xFA, 1), put(data.size(), 3);
+        qgf.insert(qgf.end(), data.begin(), data.end());
+    }
+
+    std::uint32_t total = qgf.size();
+    for (int i = 0; i < 4; ++i) {
+        qgf[9 + i]  = (std::uint8_t)(total >> (8 * i));
+        qgf[13 + i] = (std::uint8_t)(~total >> (8 * i));
+    }
+    return qgf;
+}
+
+static const std::vector<std::array<std::uint8_t, 3>> PALETTE_A = {{{0, 0, 0}}, {{0, 255, 255}}, {{85, 255, 255}}, {{170, 255, 255}}};
+static const std::vector<std::array<std::uint8_t, 3>> PALETTE_B = {{{0, 0, 0}}, {{0, 255, 255}}, {{85, 255, 255}}, {{0, 0, 255}}};
+
+// Frame 0: diagonal stripes, frame 1: a delta block of a single color, frame 2: a different palette
+static const std::vector<TestFrame> FRAMES = {
+    {PALETTE_A, 0, 0, ANIM_SIZE::value - 1, ANIM_SIZE::value - 1, false, 100, [](int x, int y) { return (std::uint8_t)((x + y) % 4); }},
+    {PALETTE_A, 4, 4, 11, 7, true, 100, [](int x, int y) { return (std::uint8_t)1; }},
+    {PALETTE_B, 0, 0, ANIM_SIZE::value - 1, ANIM_SIZE::value - 1, false, 50, [](int x, int y) { return (std::uint8_t)3; }},
+};
+
+class PainterAnimation : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        qp_virtual_panel_reset_stats(device);
+
+        // The palette cache would otherwise still hold the previous test's palette
+        qp_internal_invalidate_palette();
+
+        data  = make_animation(FRAMES);
+        image = qp_load_image_mem(data.data());
+        ASSERT_NE(image, nullptr) << "Failed to load animation";
+    }
+
+    void TearDown() override {
+        qp_stop_animation(token);
+        qp_close_image(image);
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    std::vector<std::uint8_t> data;
+    painter_image_handle_t    image = nullptr;
+    deferred_token            token = INVALID_DEFERRED_TOKEN;
+
+    // Runs the Quantum Painter task for the supplied number of milliseconds
+    void tick(std::uint32_t ms) {
+        for (std::uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            qp_internal_task();
+        }
+    }
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    std::uint16_t pixel(int x, int y) {
+        return qp_virtual_panel_get_pixel(device, ANIM_X::value + x, ANIM_Y::value + y);
+    }
+
+    // Verifies the panel matches the expected palette indices, with each index consistently mapping to one color
+    void expect_indices(const std::function<int(int, int)>& index) {
+        std::map<int, std::uint16_t> colors;
+        for (int y = 0; y < ANIM_SIZE::value; ++y) {
+            for (int x = 0; x < ANIM_SIZE::value; ++x) {
+                int i = index(x, y);
+                if (colors.count(i) == 0) {
+                    colors[i] = pixel(x, y);
+                }
+                ASSERT_EQ(pixel(x, y), colors[i]) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+painter_device_t PainterAnimation::device = nullptr;
+std::uint8_t     PainterAnimation::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that frames larger than QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK are rendered a slice at a time.
+ */
+TEST_F(PainterAnimation, LargeFrame_RenderedInSlices) {
+    token = qp_animate(device, ANIM_X::value, ANIM_Y::value, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << "Failed to start animation";
+
+    // Only the first slice is drawn immediately
+    EXPECT_EQ(stats().viewport_count, 1);
+    EXPECT_EQ(stats().pixdata_bytes, SLICE_ROWS::value * ANIM_SIZE::value * 2);
+    EXPECT_EQ(pixel(0, SLICE_ROWS::value), 0x0000) << "Rows outside the first slice should not have been drawn yet";
+
+    // The remaining slices follow on subsequent ticks
+    tick(ANIM_SIZE::value / SLICE_ROWS::value - 1);
+    EXPECT_EQ(stats().viewport_count, ANIM_SIZE::value / SLICE_ROWS::value);
+    EXPECT_EQ(stats().pixdata_bytes, ANIM_SIZE::value * ANIM_SIZE::value * 2);
+    expect_indices(FRAMES[0].index);
+    EXPECT_NE(pixel(1, 0), pixel(0, 0));
+}
+
+/**
+ * This test verifies that delta frames only send the pixels within the delta rectangle.
+ */
+TEST_F(PainterAnimation, DeltaFrame_OnlyDeltaRectSent) {
+    token = qp_animate(device, ANIM_X::value, ANIM_Y::value, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << "Failed to start animation";
+    tick(FRAMES[0].delay - 1);
+    qp_virtual_panel_reset_stats(device);
+
+    // Frame 1 is due after frame 0's delay, including the time spent on slices
+    tick(1);
+    const TestFrame& delta = FRAMES[1];
+    EXPECT_EQ(stats().viewport_count, 1);
+    EXPECT_EQ(stats().pixdata_bytes, (delta.right - delta.left + 1) * (delta.bottom - delta.top + 1) * 2);
+
+    // Everything outside the delta is untouched
+    expect_indices([&delta](int x, int y) {
+        bool inside = x >= delta.left && x <= delta.right && y >= delta.top && y <= delta.bottom;
+        return inside ? 1 : FRAMES[0].index(x, y);
+    });
+}
+
+/**
+ * This test verifies that palettes repeated between frames are only converted to native format once.
+ */
+TEST_F(PainterAnimation, RepeatedPalette_ConvertedOnce) {
+    token = qp_animate(device, ANIM_X::value, ANIM_Y::value, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << "Failed to start animation";
+    tick(FRAMES[0].delay - 1);
+    EXPECT_EQ(stats().palette_count, 4) << "Slices of the same frame should not convert the palette again";
+
+    // Frame 1 has the same palette as frame 0
+    qp_virtual_panel_reset_stats(device);
+    tick(FRAMES[1].delay);
+    EXPECT_EQ(stats().palette_count, 0) << "Unchanged palette should not have been converted";
+
+    // Frame 2 has a different palette
+    qp_virtual_panel_reset_stats(device);
+    tick(FRAMES[2].delay);
+    EXPECT_EQ(stats().palette_count, 4) << "Changed palette should have been converted";
+    expect_indices(FRAMES[2].index);
+
+    // Looping back to frame 0 needs the original palette again
+    qp_virtual_panel_reset_stats(device);
+    tick(ANIM_SIZE::value / SLICE_ROWS::value);
+    EXPECT_EQ(stats().palette_count, 4) << "Changed palette should have been converted";
+    expect_indices(FRAMES[0].index);
+}
@@ -0,0 +1,176 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <functional>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_surface.h"
+#include "graphics/lock-caps-ON.qgf.h"
+#include "graphics/thintel15.qff.h"
+}
+
+// Geometry of the virtual panel and reference surface used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 64>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+// Number of RGB565 pixels that fit in each pixdata buffer
+using PIXELS_PER_BUFFER = std::integral_constant<std::uint32_t, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2>;
+
+class PainterAsync : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel and surfaces are used across all tests
+        device    = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+        reference = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, reference_buffer);
+        surface   = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, surface_buffer);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_NE(reference, nullptr) << "Failed to create reference surface";
+        ASSERT_NE(surface, nullptr) << "Failed to create surface";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0)) << "Failed to initialise reference surface";
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0)) << "Failed to initialise surface";
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    static painter_device_t device;
+    static painter_device_t reference;
+    static painter_device_t surface;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     reference_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    // Renders the same scene to both the virtual panel and the reference surface, which doesn't transfer asynchronously
+    void render(const std::function<void(painter_device_t)>& scene) {
+        scene(reference);
+        qp_virtual_panel_reset_stats(device);
+        scene(device);
+    }
+
+    // Verifies the virtual panel matches the reference surface
+    void expect_matches_reference() {
+        const std::uint16_t* expected = (const std::uint16_t*)reference_buffer;
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                // Surfaces hold pixels in transmission order, i.e. big-endian
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), __builtin_bswap16(expected[y * PANEL_WIDTH::value + x])) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+
+    // Verifies transfers were asynchronous, alternating between buffers, with no buffer modified while in flight
+    void expect_double_buffered(std::uint32_t min_transfers) {
+        EXPECT_GE(stats().async_count, min_transfers);
+        EXPECT_GT(stats().async_swaps, 0) << "Transfers should have alternated between pixdata buffers";
+        EXPECT_EQ(stats().async_modified, 0) << "Pixdata buffer was modified while it was still being transferred";
+        EXPECT_EQ(stats().order_errors, 0) << "Comms were issued while a transfer was still outstanding";
+    }
+};
+
+painter_device_t PainterAsync::device    = nullptr;
+painter_device_t PainterAsync::reference = nullptr;
+painter_device_t PainterAsync::surface   = nullptr;
+std::uint8_t     PainterAsync::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterAsync::reference_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterAsync::surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that large fills are transferred asynchronously, and complete before the drawing call returns.
+ */
+TEST_F(PainterAsync, FilledRect_Async) {
+    render([](painter_device_t d) { qp_rect(d, 2, 3, 61, 28, HSV_BLUE, true); });
+    expect_matches_reference();
+
+    std::uint32_t pixels = 60 * 26;
+    EXPECT_EQ(stats().async_count, (pixels + PIXELS_PER_BUFFER::value - 1) / PIXELS_PER_BUFFER::value);
+    EXPECT_EQ(stats().pixdata_bytes, pixels * 2);
+    EXPECT_EQ(stats().async_modified, 0);
+    EXPECT_EQ(stats().order_errors, 0);
+}
+
+/**
+ * This test verifies that images are decoded into one pixdata buffer while the other is being transferred.
+ */
+TEST_F(PainterAsync, Image_DoubleBuffered) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_lock_caps_ON);
+    ASSERT_NE(image, nullptr) << "Failed to load image";
+
+    render([image](painter_device_t d) {
+        qp_rect(d, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLACK, true);
+        qp_drawimage(d, 1, 1, image);
+        qp_drawimage_recolor(d, 30, 1, image, HSV_RED, HSV_BLUE);
+    });
+    expect_matches_reference();
+    expect_double_buffered(2 * image->width * image->height / PIXELS_PER_BUFFER::value);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that text is decoded into one pixdata buffer while the other is being transferred.
+ */
+TEST_F(PainterAsync, Text_DoubleBuffered) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    render([font](painter_device_t d) {
+        qp_rect(d, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLACK, true);
+        qp_drawtext(d, 0, 0, font, "Quantum");
+        qp_drawtext_recolor(d, 0, 16, font, "Painter", HSV_GREEN, HSV_BLACK);
+    });
+    expect_matches_reference();
+    expect_double_buffered(2);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that surfaces are copied into one pixdata buffer while the other is being transferred.
+ */
+TEST_F(PainterAsync, SurfaceDraw_DoubleBuffered) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_lock_caps_ON);
+    ASSERT_NE(image, nullptr) << "Failed to load image";
+
+    auto scene = [image](painter_device_t d) {
+        qp_rect(d, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_PURPLE, true);
+        qp_drawimage(d, 10, 2, image);
+        qp_line(d, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_WHITE);
+    };
+    scene(reference);
+    scene(surface);
+    qp_virtual_panel_reset_stats(device);
+    ASSERT_TRUE(qp_surface_draw(surface, device, 0, 0, true));
+
+    expect_matches_reference();
+    expect_double_buffered(PANEL_WIDTH::value * PANEL_HEIGHT::value / PIXELS_PER_BUFFER::value);
+    EXPECT_EQ(stats().viewport_count, 1);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that commands sent after an asynchronous transfer are only issued once the transfer completes.
+ */
+TEST_F(PainterAsync, Command_WaitsForTransfer) {
+    ASSERT_TRUE(qp_viewport(device, 0, 0, 1, 0));
+    std::uint16_t pixels[2] = {0x00F8, 0xE007}; // red, green, in transmission order
+
+    ASSERT_TRUE(qp_comms_start(device));
+    EXPECT_EQ(qp_comms_send_async(device, pixels, sizeof(pixels)), sizeof(pixels));
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 0, 0), 0x0000) << "Transfer should still be outstanding";
+    qp_comms_command(device, 0x00); // no-op
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 0, 0), 0xF800) << "Transfer should have completed before the command";
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 1, 0), 0x07E0) << "Transfer should have completed before the command";
+    qp_comms_stop(device);
+
+    EXPECT_EQ(stats().async_count, 1);
+    EXPECT_EQ(stats().order_errors, 0);
+}
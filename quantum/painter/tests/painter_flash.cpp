@@ -0,0 +1,149 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "flash.h"
+#include "qp.h"
+#include "qp_stream.h"
+#include "qp_surface.h"
+#include "graphics/lock-caps-ON.qgf.h"
+#include "graphics/thintel15.qff.h"
+}
+
+// Geometry of the virtual panel used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 128>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+// Locations of the assets within the emulated external flash
+using IMAGE_ADDRESS = std::integral_constant<std::uint32_t, 0x1000>;
+using FONT_ADDRESS  = std::integral_constant<std::uint32_t, 0x3000>;
+
+// Emulated external flash, erased to 0xFF
+static std::vector<std::uint8_t> flash_data(0x8000, 0xFF);
+static std::uint32_t             flash_reads      = 0;
+static std::uint32_t             flash_bytes_read = 0;
+
+extern "C" flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    if (addr + len > flash_data.size()) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    std::copy(flash_data.begin() + addr, flash_data.begin() + addr + len, (std::uint8_t *)buf);
+    flash_reads++;
+    flash_bytes_read += len;
+    return FLASH_STATUS_SUCCESS;
+}
+
+class PainterFlash : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+
+        std::copy(gfx_lock_caps_ON, gfx_lock_caps_ON + gfx_lock_caps_ON_length, flash_data.begin() + IMAGE_ADDRESS::value);
+        std::copy(font_thintel15, font_thintel15 + font_thintel15_length, flash_data.begin() + FONT_ADDRESS::value);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        qp_flash_stream_invalidate_cache();
+        flash_reads      = 0;
+        flash_bytes_read = 0;
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    // Verifies the left and right halves of the panel are identical
+    void expect_halves_match() {
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value / 2; ++x) {
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), qp_virtual_panel_get_pixel(device, x + PANEL_WIDTH::value / 2, y)) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+painter_device_t PainterFlash::device = nullptr;
+std::uint8_t     PainterFlash::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that images loaded from external flash render the same as images loaded from memory.
+ */
+TEST_F(PainterFlash, Image_MatchesMemory) {
+    painter_image_handle_t flash_image = qp_load_image_flash(IMAGE_ADDRESS::value);
+    ASSERT_NE(flash_image, nullptr) << "Failed to load image from flash";
+    painter_image_handle_t mem_image = qp_load_image_mem(gfx_lock_caps_ON);
+    ASSERT_NE(mem_image, nullptr) << "Failed to load image from memory";
+    EXPECT_EQ(flash_image->width, mem_image->width);
+    EXPECT_EQ(flash_image->height, mem_image->height);
+
+    EXPECT_TRUE(qp_drawimage_recolor(device, 0, 0, mem_image, HSV_RED, HSV_BLUE));
+    EXPECT_TRUE(qp_drawimage_recolor(device, PANEL_WIDTH::value / 2, 0, flash_image, HSV_RED, HSV_BLUE));
+    expect_halves_match();
+
+    EXPECT_TRUE(qp_close_image(flash_image));
+    EXPECT_TRUE(qp_close_image(mem_image));
+}
+
+/**
+ * This test verifies that fonts loaded from external flash render the same as fonts loaded from memory.
+ */
+TEST_F(PainterFlash, Font_MatchesMemory) {
+    painter_font_handle_t flash_font = qp_load_font_flash(FONT_ADDRESS::value);
+    ASSERT_NE(flash_font, nullptr) << "Failed to load font from flash";
+    painter_font_handle_t mem_font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(mem_font, nullptr) << "Failed to load font from memory";
+
+    EXPECT_EQ(qp_textwidth(flash_font, "QMK!"), qp_textwidth(mem_font, "QMK!"));
+    EXPECT_GT(qp_drawtext(device, 0, 0, mem_font, "QMK!"), 0);
+    EXPECT_GT(qp_drawtext(device, PANEL_WIDTH::value / 2, 0, flash_font, "QMK!"), 0);
+    expect_halves_match();
+
+    EXPECT_TRUE(qp_close_font(flash_font));
+    EXPECT_TRUE(qp_close_font(mem_font));
+}
+
+/**
+ * This test verifies that sequential reads go through the read-ahead cache, instead of reading a byte at a time.
+ */
+TEST_F(PainterFlash, SequentialReads_UseReadAhead) {
+    painter_image_handle_t image = qp_load_image_flash(IMAGE_ADDRESS::value);
+    ASSERT_NE(image, nullptr) << "Failed to load image from flash";
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+
+    // Each block of the image is read at most a couple of times, in bursts of up to the cache size
+    EXPECT_LE(flash_reads, 2 * (gfx_lock_caps_ON_length / QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE + 4));
+    EXPECT_LE(flash_bytes_read, 2 * gfx_lock_caps_ON_length);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that large reads bypass the read-ahead cache, in a single burst.
+ */
+TEST_F(PainterFlash, LargeRead_SingleBurst) {
+    qp_flash_stream_t   stream = qp_make_flash_stream(FONT_ADDRESS::value, font_thintel15_length);
+    std::vector<std::uint8_t> data(font_thintel15_length);
+    EXPECT_EQ(qp_stream_read(data.data(), 1, data.size(), &stream), data.size());
+    EXPECT_EQ(data, std::vector<std::uint8_t>(font_thintel15, font_thintel15 + font_thintel15_length));
+    EXPECT_EQ(flash_reads, 1);
+    EXPECT_FALSE(qp_stream_eof(&stream));
+
+    // Reading past the end stops at the end of the stream
+    qp_stream_setpos(&stream, font_thintel15_length - 2);
+    EXPECT_EQ(qp_stream_read(data.data(), 1, 4, &stream), 2);
+    EXPECT_TRUE(qp_stream_eof(&stream));
+    EXPECT_EQ(qp_stream_get(&stream), STREAM_EOF);
+}
+
+/**
+ * This test verifies that erased or missing assets fail to load.
+ */
+TEST_F(PainterFlash, ErasedFlash_Rejected) {
+    EXPECT_EQ(qp_load_image_flash(0x0000), nullptr) << "Erased flash should not be loadable as an image";
+    EXPECT_EQ(qp_load_font_flash(0x0000), nullptr) << "Erased flash should not be loadable as a font";
+    EXPECT_EQ(qp_load_font_flash(flash_data.size() + 0x1000), nullptr) << "Out of range addresses should not be loadable";
+}
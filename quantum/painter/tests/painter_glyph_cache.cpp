@@ -0,0 +1,225 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_surface.h"
+#include "graphics/thintel15.qff.h"
+}
+
+// Geometry of the virtual panel used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 128>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+// Offset of the glyph pixel data within thintel15 -- font descriptor, ascii table, then the data block header
+using THINTEL15_DATA_OFFSET = std::integral_constant<std::size_t, 25 + 290 + 5>;
+
+class PainterGlyphCache : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        qp_virtual_panel_reset_stats(device);
+
+        // Fonts are loaded from a copy in RAM, so the glyph data can be modified after it's been cached
+        font_data.assign(font_thintel15, font_thintel15 + font_thintel15_length);
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    std::vector<std::uint8_t> font_data;
+
+    // Overwrites all glyph pixel data, so any glyph decoded from the font afterwards renders differently
+    void corrupt_glyph_data() {
+        std::fill(font_data.begin() + THINTEL15_DATA_OFFSET::value, font_data.end(), 0xAA);
+    }
+
+    void clear() {
+        qp_rect(device, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLACK, true);
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    std::vector<std::uint16_t> snapshot() {
+        std::vector<std::uint16_t> pixels;
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                pixels.push_back(qp_virtual_panel_get_pixel(device, x, y));
+            }
+        }
+        return pixels;
+    }
+
+    std::uint32_t pixdata_bytes() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s.pixdata_bytes;
+    }
+};
+
+painter_device_t PainterGlyphCache::device = nullptr;
+std::uint8_t     PainterGlyphCache::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+// Builds a minimal QFF containing only a unicode table, with 2x2 GRAYSCALE_1BPP glyphs
+static std::vector<std::uint8_t> make_unicode_font(const std::vector<std::pair<std::uint32_t, std::uint8_t>>& glyphs) {
+    const std::uint32_t       total_size = 25 + (5 + glyphs.size() * 6) + (5 + glyphs.size());
+    std::vector<std::uint8_t> font;
+    auto                      put = [&font](std::uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            font.push_back((std::uint8_t)(value >> (8 * i)));
+        }
+    };
+
+    // Font descriptor
+    put(0x00, 1), put(0xFF, 1), put(20, 3);
+    put(0x464651, 3), put(0x01, 1), put(total_size, 4), put(~total_size, 4);
+    put(2, 1), put(0, 1), put(glyphs.size(), 2), put(GRAYSCALE_1BPP, 1), put(0, 1), put(IMAGE_UNCOMPRESSED, 1), put(0xFF, 1);
+
+    // Unicode glyph table -- each glyph is 2 pixels wide, and its data is a single byte
+    put(0x02, 1), put(0xFD, 1), put(glyphs.size() * 6, 3);
+    for (std::size_t i = 0; i < glyphs.size(); ++i) {
+        put(glyphs[i].first, 3), put((i << 6) | 2, 3);
+    }
+
+    // Glyph data
+    put(0x04, 1), put(0xFB, 1), put(glyphs.size(), 3);
+    for (auto& glyph : glyphs) {
+        put(glyph.second, 1);
+    }
+
+    return font;
+}
+
+/**
+ * This test verifies that redrawing text uses the cached glyphs, and doesn't read the font's glyph data again.
+ */
+TEST_F(PainterGlyphCache, Redraw_UsesCachedGlyphs) {
+    painter_font_handle_t font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    int16_t width    = qp_drawtext(device, 2, 2, font, "QMK");
+    auto    expected = snapshot();
+    auto    bytes    = pixdata_bytes();
+
+    corrupt_glyph_data();
+    clear();
+    EXPECT_EQ(qp_drawtext(device, 2, 2, font, "QMK"), width);
+    EXPECT_EQ(snapshot(), expected) << "Cached glyphs should not have been decoded again";
+    EXPECT_EQ(pixdata_bytes(), bytes) << "Cached glyphs should send the same amount of pixel data";
+    EXPECT_EQ(qp_textwidth(font, "QMK"), width);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that glyphs drawn with different colors are cached separately.
+ */
+TEST_F(PainterGlyphCache, Recolor_NotShared) {
+    painter_font_handle_t font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    int16_t width = qp_drawtext(device, 0, 0, font, "W");
+    ASSERT_GT(width, 0);
+    EXPECT_EQ(qp_drawtext_recolor(device, 0, 0, font, "W", HSV_RED, HSV_BLACK), width);
+
+    int red = 0;
+    for (std::uint16_t y = 0; y < font->line_height; ++y) {
+        for (std::uint16_t x = 0; x < width; ++x) {
+            std::uint16_t pixel = qp_virtual_panel_get_pixel(device, x, y);
+            EXPECT_NE(pixel, 0xFFFF) << "Glyph was drawn with the previously cached colors at (" << x << ", " << y << ")";
+            red += (pixel == 0xF800);
+        }
+    }
+    EXPECT_GT(red, 0) << "Glyph was not drawn in red";
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that closing a font drops its cached glyphs, even if the font handle is reused.
+ */
+TEST_F(PainterGlyphCache, CloseFont_DropsCachedGlyphs) {
+    painter_font_handle_t font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+    qp_drawtext(device, 2, 2, font, "QMK");
+    auto expected = snapshot();
+    EXPECT_TRUE(qp_close_font(font));
+
+    corrupt_glyph_data();
+    clear();
+    font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+    qp_drawtext(device, 2, 2, font, "QMK");
+    EXPECT_NE(snapshot(), expected) << "Glyphs should have been decoded from the modified font";
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that the least recently used glyphs are evicted once the cache is full.
+ */
+TEST_F(PainterGlyphCache, Full_EvictsLeastRecentlyUsed) {
+    // Reference renders, from a separate font handle so they're cached separately
+    painter_font_handle_t reference = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(reference, nullptr) << "Failed to load font";
+    qp_drawtext(device, 0, 0, reference, "A");
+    auto expected_a = snapshot();
+    clear();
+    qp_drawtext(device, 0, 0, reference, "H");
+    auto expected_h = snapshot();
+    EXPECT_TRUE(qp_close_font(reference));
+
+    // More glyphs than the cache can hold -- only the most recent ones are kept
+    painter_font_handle_t font = qp_load_font_mem(font_data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+    qp_drawtext(device, 0, 16, font, "ABCDEFGH");
+    corrupt_glyph_data();
+
+    clear();
+    qp_drawtext(device, 0, 0, font, "H");
+    EXPECT_EQ(snapshot(), expected_h) << "Most recently used glyph should still be cached";
+    clear();
+    qp_drawtext(device, 0, 0, font, "A");
+    EXPECT_NE(snapshot(), expected_a) << "Least recently used glyph should have been evicted";
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that unicode glyphs are found in the sorted glyph table.
+ */
+TEST_F(PainterGlyphCache, UnicodeTable_Lookup) {
+    const std::vector<std::pair<std::uint32_t, std::uint8_t>> glyphs = {{0x00A9, 0x01}, {0x2190, 0x02}, {0x2191, 0x04}, {0x263A, 0x08}, {0x1F600, 0x09}};
+    const char* strings[]                                            = {"©", "←", "↑", "☺", "\U0001F600"};
+
+    auto                  data = make_unicode_font(glyphs);
+    painter_font_handle_t font = qp_load_font_mem(data.data());
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    for (std::size_t i = 0; i < glyphs.size(); ++i) {
+        EXPECT_EQ(qp_drawtext(device, 0, 0, font, strings[i]), 2) << "Failed to draw glyph U+" << std::hex << glyphs[i].first;
+        for (std::uint16_t p = 0; p < 4; ++p) {
+            bool set = (glyphs[i].second >> p) & 1;
+            EXPECT_EQ(qp_virtual_panel_get_pixel(device, p % 2, p / 2), set ? 0xFFFF : 0x0000) << "Unexpected pixel " << p << " for glyph U+" << std::hex << glyphs[i].first;
+        }
+    }
+
+    EXPECT_EQ(qp_textwidth(font, "©☺\U0001F600"), 6);
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "→"), 0) << "Glyph not in the font should fail to draw";
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+/**
+ * This test verifies that fonts with an unsorted unicode glyph table are rejected.
+ */
+TEST_F(PainterGlyphCache, UnicodeTable_UnsortedRejected) {
+    auto data = make_unicode_font({{0x2190, 0x01}, {0x00A9, 0x02}});
+    EXPECT_EQ(qp_load_font_mem(data.data()), nullptr) << "Unsorted glyph table should fail validation";
+
+    data = make_unicode_font({{0x00A9, 0x01}, {0x00A9, 0x02}});
+    EXPECT_EQ(qp_load_font_mem(data.data()), nullptr) << "Duplicate glyphs should fail validation";
+}
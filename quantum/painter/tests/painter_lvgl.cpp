@@ -0,0 +1,144 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "lvgl.h"
+void qp_lvgl_internal_tick(void);
+void advance_time(uint32_t ms);
+
+// No keyboard is running, so there's never any input activity to wake LVGL early
+uint32_t last_input_activity_time(void) {
+    return 0;
+}
+}
+
+// Geometry of the virtual panel used for all tests -- with the default buffer divisor, each draw buffer holds 3 rows
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 32>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 30>;
+using BUFFER_ROWS  = std::integral_constant<std::uint16_t, PANEL_HEIGHT::value / QP_LVGL_BUFFER_DIVISOR>;
+
+class PainterLVGL : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        ASSERT_TRUE(qp_lvgl_attach(device)) << "Failed to attach LVGL";
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    void TearDown() override {
+        qp_lvgl_detach();
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    // Marks an area to be redrawn by LVGL in an RGB565 colour, which LVGL holds byte-swapped
+    void invalidate(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, std::uint16_t rgb565) {
+        lv_area_t area = {x1, y1, x2, y2};
+        lv_stub_invalidate(&area, __builtin_bswap16(rgb565));
+    }
+
+    // Runs the LVGL task once -- directly, as qp_internal_task() would also flush the panel and so release the bus anyway
+    void run_lvgl() {
+        advance_time(QP_LVGL_IDLE_PERIOD);
+        qp_lvgl_internal_tick();
+    }
+
+    void expect_area(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2, std::uint16_t rgb565) {
+        for (lv_coord_t y = y1; y <= y2; ++y) {
+            for (lv_coord_t x = x1; x <= x2; ++x) {
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), rgb565) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+
+    // Verifies no buffer was rendered into while in flight, and the bus was released once LVGL was done
+    void expect_clean_handoff() {
+        EXPECT_EQ(stats().async_modified, 0) << "LVGL rendered into a buffer that was still being transferred";
+        EXPECT_EQ(stats().order_errors, 0) << "Comms were issued while a transfer was still outstanding";
+        EXPECT_FALSE(stats().comms_active) << "The bus was still held after the LVGL task returned";
+    }
+};
+
+painter_device_t PainterLVGL::device = nullptr;
+std::uint8_t     PainterLVGL::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that a full screen refresh, rendered in several parts, reaches the panel intact.
+ */
+TEST_F(PainterLVGL, FullRefresh_Flushed) {
+    invalidate(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0xF800);
+    run_lvgl();
+
+    EXPECT_EQ(lv_stub_flush_count(), PANEL_HEIGHT::value / BUFFER_ROWS::value);
+    EXPECT_EQ(stats().async_count, lv_stub_flush_count()) << "Each area should be sent as one asynchronous transfer";
+    expect_area(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0xF800);
+    expect_clean_handoff();
+#if QP_LVGL_BUFFER_COUNT > 1
+    EXPECT_EQ(stats().async_swaps, lv_stub_flush_count() - 1) << "Areas should alternate between draw buffers";
+#else
+    EXPECT_EQ(stats().async_swaps, 0);
+#endif
+}
+
+/**
+ * This test verifies that separate areas are each flushed to their own position.
+ */
+TEST_F(PainterLVGL, MultipleAreas_Flushed) {
+    invalidate(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0x0000);
+    run_lvgl();
+    qp_virtual_panel_reset_stats(device);
+
+    invalidate(2, 1, 9, 4, 0x07E0);
+    invalidate(10, 20, 29, 29, 0x001F);
+    invalidate(0, 8, 31, 8, 0xFFFF);
+    run_lvgl();
+
+    expect_area(2, 1, 9, 4, 0x07E0);
+    expect_area(10, 20, 29, 29, 0x001F);
+    expect_area(0, 8, 31, 8, 0xFFFF);
+    expect_area(0, 9, 31, 19, 0x0000);
+    expect_clean_handoff();
+}
+
+/**
+ * This test verifies that the display is released between LVGL task runs, so other painter calls can use the bus.
+ */
+TEST_F(PainterLVGL, BetweenTasks_BusReleased) {
+    invalidate(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0x1234);
+    run_lvgl();
+    expect_clean_handoff();
+
+    // Drawing directly is not disturbed by anything left over from LVGL
+    EXPECT_TRUE(qp_rect(device, 0, 0, 3, 3, 0, 0, 0, true));
+    expect_area(0, 0, 3, 3, 0x0000);
+    expect_area(4, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0x1234);
+    expect_clean_handoff();
+}
+
+/**
+ * This test verifies that detaching while a transfer may be in flight completes it and releases the bus.
+ */
+TEST_F(PainterLVGL, Detach_ReleasesBus) {
+    invalidate(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0xABCD);
+    lv_task_handler();
+    qp_lvgl_detach();
+
+    expect_area(0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, 0xABCD);
+    expect_clean_handoff();
+}
@@ -0,0 +1,207 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_draw.h"
+void qp_internal_task(void);
+void advance_time(uint32_t ms);
+}
+
+// Geometry of the virtual panel used for all tests, images are drawn side by side -- each half is large enough for a
+// PALETTE_2BPP frame of more than 64kB
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 1024>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 528>;
+
+struct TestFrame {
+    painter_compression_t     compression;
+    std::vector<std::uint8_t> data; // PALETTE_2BPP pixel data, encoded as per the compression scheme
+};
+
+// Builds a PALETTE_2BPP QGF image, or an animation if more than one frame is supplied
+static std::vector<std::uint8_t> make_image(std::uint16_t width, std::uint16_t height, const std::vector<TestFrame>& frames) {
+    std::vector<std::uint8_t> qgf;
+    auto                      put = [&qgf](std::uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            qgf.push_back((std::uint8_t)(value >> (8 * i)));
+        }
+    };
+
+    // Graphics descriptor, total size is filled in later
+    put(0x00, 1), put(0xFF, 1), put(18, 3);
+    put(0x464751, 3), put(0x01, 1), put(0, 4), put(0, 4);
+    put(width, 2), put(height, 2), put(frames.size(), 2);
+
+    // Frame offsets, filled in later
+    put(0x01, 1), put(0xFE, 1), put(frames.size() * 4, 3);
+    const std::size_t offsets_pos = qgf.size();
+    put(0, 4 * frames.size());
+
+    for (std::size_t f = 0; f < frames.size(); ++f) {
+        for (int i = 0; i < 4; ++i) {
+            qgf[offsets_pos + f * 4 + i] = (std::uint8_t)(qgf.size() >> (8 * i));
+        }
+
+        // Frame descriptor, palette, and pixel data
+        put(0x02, 1), put(0xFD, 1), put(6, 3);
+        put(PALETTE_2BPP, 1), put(0x00, 1), put(frames[f].compression, 1), put(0xFF, 1), put(100, 2);
+        put(0x03, 1), put(0xFC, 1), put(4 * 3, 3);
+        put(0x000000, 3), put(0xFFFF00, 3), put(0xFFFF55, 3), put(0xFFFFAA, 3);
+        put(0x05, 1), put(0xFA, 1), put(frames[f].data.size(), 3);
+        qgf.insert(qgf.end(), frames[f].data.begin(), frames[f].data.end());
+    }
+
+    std::uint32_t total = qgf.size();
+    for (int i = 0; i < 4; ++i) {
+        qgf[9 + i]  = (std::uint8_t)(total >> (8 * i));
+        qgf[13 + i] = (std::uint8_t)(~total >> (8 * i));
+    }
+    return qgf;
+}
+
+class PainterLZ : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    // Draws the LZ-compressed image on the right, and the equivalent uncompressed image on the left, and verifies they match
+    void expect_matches_uncompressed(std::uint16_t width, std::uint16_t height, const std::vector<std::uint8_t>& lz, const std::vector<std::uint8_t>& raw) {
+        ASSERT_EQ(raw.size(), width * height / 4) << "Reference data doesn't match the image size";
+        std::vector<std::uint8_t> lz_data  = make_image(width, height, {{IMAGE_COMPRESSED_LZ, lz}});
+        std::vector<std::uint8_t> raw_data = make_image(width, height, {{IMAGE_UNCOMPRESSED, raw}});
+        painter_image_handle_t    lz_image = qp_load_image_mem(lz_data.data());
+        ASSERT_NE(lz_image, nullptr) << "Failed to load LZ image";
+        painter_image_handle_t raw_image = qp_load_image_mem(raw_data.data());
+        ASSERT_NE(raw_image, nullptr) << "Failed to load uncompressed image";
+
+        EXPECT_TRUE(qp_drawimage(device, 0, 0, raw_image));
+        EXPECT_TRUE(qp_drawimage(device, PANEL_WIDTH::value / 2, 0, lz_image));
+        expect_halves_match(width, height);
+
+        EXPECT_TRUE(qp_close_image(lz_image));
+        EXPECT_TRUE(qp_close_image(raw_image));
+    }
+
+    void expect_halves_match(std::uint16_t width, std::uint16_t height) {
+        for (std::uint16_t y = 0; y < height; ++y) {
+            for (std::uint16_t x = 0; x < width; ++x) {
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), qp_virtual_panel_get_pixel(device, x + PANEL_WIDTH::value / 2, y)) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+painter_device_t PainterLZ::device = nullptr;
+std::uint8_t     PainterLZ::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that matches overlapping the data they produce repeat the preceding pattern.
+ */
+TEST_F(PainterLZ, OverlappingMatch_RepeatsPattern) {
+    // 3 literals, then a 61-byte match at distance 3
+    std::vector<std::uint8_t> lz = {0x3F, 0x1B, 0xE4, 0x55, 0x02, 61 - 4 - 15};
+    std::vector<std::uint8_t> raw;
+    for (int i = 0; i < 64; ++i) {
+        raw.push_back(lz[1 + i % 3]);
+    }
+    expect_matches_uncompressed(16, 16, lz, raw);
+}
+
+/**
+ * This test verifies that literal and match lengths spanning several extension bytes are decoded.
+ */
+TEST_F(PainterLZ, ExtendedLengths_Decoded) {
+    // 20 literals, then a 492-byte match at distance 20 -- 492 - 4 - 15 = 473 = 255 + 218
+    std::vector<std::uint8_t> lz = {0xFF, 20 - 15};
+    std::vector<std::uint8_t> raw;
+    for (int i = 0; i < 20; ++i) {
+        lz.push_back((std::uint8_t)(i * 37));
+    }
+    lz.insert(lz.end(), {19, 255, 218});
+    for (int i = 0; i < 512; ++i) {
+        raw.push_back(lz[2 + i % 20]);
+    }
+    expect_matches_uncompressed(64, 32, lz, raw);
+}
+
+/**
+ * This test verifies that lengths beyond 65535 are decoded, as produced for large frames of a single colour.
+ */
+TEST_F(PainterLZ, LengthsBeyond64k_Decoded) {
+    // 1 literal, then a 67583-byte match at distance 1 -- 67583 - 4 - 15 = 67564 = 264 * 255 + 244
+    std::vector<std::uint8_t> lz = {0x1F, 0xE4, 0x00};
+    lz.insert(lz.end(), 264, 255);
+    lz.push_back(244);
+    std::vector<std::uint8_t> raw(512 * 528 / 4, 0xE4);
+    ASSERT_GT(raw.size(), 65536u);
+    expect_matches_uncompressed(512, 528, lz, raw);
+}
+
+/**
+ * This test verifies that the final sequence may consist solely of literals, without a trailing match offset.
+ */
+TEST_F(PainterLZ, TrailingLiterals_Decoded) {
+    // 4 literals, a 56-byte match at distance 4, then 4 trailing literals
+    std::vector<std::uint8_t> lz  = {0x4F, 0xAA, 0x00, 0xFF, 0x55, 0x03, 56 - 4 - 15, 0x40, 0x12, 0x34, 0x56, 0x78};
+    std::vector<std::uint8_t> raw = {};
+    for (int i = 0; i < 60; ++i) {
+        raw.push_back(lz[1 + i % 4]);
+    }
+    raw.insert(raw.end(), {0x12, 0x34, 0x56, 0x78});
+    expect_matches_uncompressed(16, 16, lz, raw);
+}
+
+/**
+ * This test verifies that truncated data fails to draw, rather than reading past the end of the image.
+ */
+TEST_F(PainterLZ, TruncatedData_Fails) {
+    std::vector<std::uint8_t> data  = make_image(16, 16, {{IMAGE_COMPRESSED_LZ, {0x3F, 0x1B, 0xE4, 0x55, 0x02}}});
+    painter_image_handle_t    image = qp_load_image_mem(data.data());
+    ASSERT_NE(image, nullptr) << "Failed to load LZ image";
+    EXPECT_FALSE(qp_drawimage(device, 0, 0, image));
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+/**
+ * This test verifies that matches referring back across animation slices are decoded, as the window is retained between ticks.
+ */
+TEST_F(PainterLZ, Animation_WindowRetainedAcrossSlices) {
+    // Frame pixel data spans several QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK slices, with the match starting in the first
+    std::vector<std::uint8_t> lz = {0x5F, 0x01, 0x23, 0x45, 0x67, 0x89, 0x04, 256 - 5 - 4 - 15};
+    std::vector<std::uint8_t> raw;
+    for (int i = 0; i < 256; ++i) {
+        raw.push_back(lz[1 + i % 5]);
+    }
+    std::vector<std::uint8_t> anim_data = make_image(32, 32, {{IMAGE_COMPRESSED_LZ, lz}, {IMAGE_COMPRESSED_LZ, lz}});
+    std::vector<std::uint8_t> raw_data  = make_image(32, 32, {{IMAGE_UNCOMPRESSED, raw}});
+    painter_image_handle_t    anim      = qp_load_image_mem(anim_data.data());
+    ASSERT_NE(anim, nullptr) << "Failed to load LZ animation";
+    painter_image_handle_t raw_image = qp_load_image_mem(raw_data.data());
+    ASSERT_NE(raw_image, nullptr) << "Failed to load uncompressed image";
+
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, raw_image));
+    deferred_token token = qp_animate(device, PANEL_WIDTH::value / 2, 0, anim);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN) << "Failed to start animation";
+    for (int i = 0; i < 32 * 32 / QUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK; ++i) {
+        advance_time(1);
+        qp_internal_task();
+    }
+    expect_halves_match(32, 32);
+
+    qp_stop_animation(token);
+    EXPECT_TRUE(qp_close_image(anim));
+    EXPECT_TRUE(qp_close_image(raw_image));
+}
@@ -0,0 +1,132 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+#include "graphics/thintel15.qff.h"
+}
+
+// Geometry of the virtual panel and surface used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 64>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+class PainterPalette : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel and surface are used across all tests
+        device  = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+        surface = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, surface_buffer);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_NE(surface, nullptr) << "Failed to create surface";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0)) << "Failed to initialise surface";
+        font = qp_load_font_mem(font_thintel15);
+        ASSERT_NE(font, nullptr) << "Failed to load font";
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    static painter_device_t device;
+    static painter_device_t surface;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    painter_font_handle_t font = nullptr;
+
+    // Number of palette entries converted to the virtual panel's native format since the last reset
+    std::uint32_t converted() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s.palette_count;
+    }
+};
+
+painter_device_t PainterPalette::device  = nullptr;
+painter_device_t PainterPalette::surface = nullptr;
+std::uint8_t     PainterPalette::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterPalette::surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that the batch RGB565 converter matches hsv_to_rgb_nocie() for every possible input.
+ */
+TEST_F(PainterPalette, BatchConvert_MatchesHsvToRgb) {
+    qp_pixel_t palette[256];
+    for (int h = 0; h < 256; ++h) {
+        for (int s = 0; s < 256; ++s) {
+            for (int v = 0; v < 256; ++v) {
+                palette[v].hsv888 = {(std::uint8_t)h, (std::uint8_t)s, (std::uint8_t)v};
+            }
+            qp_internal_palette_convert_rgb565_swapped(palette, 256);
+            for (int v = 0; v < 256; ++v) {
+                rgb_t         rgb      = hsv_to_rgb_nocie((hsv_t){(std::uint8_t)h, (std::uint8_t)s, (std::uint8_t)v});
+                std::uint16_t expected = __builtin_bswap16((rgb.r >> 3) << 11 | (rgb.g >> 2) << 5 | (rgb.b >> 3));
+                ASSERT_EQ(palette[v].rgb565, expected) << "Mismatch for H: " << h << ", S: " << s << ", V: " << v;
+            }
+        }
+    }
+}
+
+/**
+ * This test verifies that alternating between recently used colors reuses their converted palettes.
+ */
+TEST_F(PainterPalette, AlternatingColors_Reused) {
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "QMK", HSV_RED, HSV_BLACK), 0);
+    std::uint32_t per_palette = converted();
+    EXPECT_GT(per_palette, 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 16, font, "QMK", HSV_BLUE, HSV_BLACK), 0);
+    EXPECT_EQ(converted(), 2 * per_palette);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "QMK", HSV_RED, HSV_BLACK), 0);
+        EXPECT_GT(qp_drawtext_recolor(device, 0, 16, font, "QMK", HSV_BLUE, HSV_BLACK), 0);
+    }
+    EXPECT_EQ(converted(), 2 * per_palette) << "Cached palettes should not have been converted again";
+
+    // Cached palettes render identically to freshly converted ones
+    std::uint16_t cached_pixel = 0;
+    for (std::uint16_t x = 0; x < PANEL_WIDTH::value && cached_pixel == 0; ++x) {
+        for (std::uint16_t y = 0; y < 16 && cached_pixel == 0; ++y) {
+            cached_pixel = qp_virtual_panel_get_pixel(device, x, y);
+        }
+    }
+    EXPECT_EQ(cached_pixel, 0xF800);
+}
+
+/**
+ * This test verifies that the least recently used palette is evicted once the cache is full.
+ */
+TEST_F(PainterPalette, CacheFull_EvictsLeastRecentlyUsed) {
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_GREEN, HSV_BLACK), 0);
+    std::uint32_t per_palette = converted();
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_CYAN, HSV_BLACK), 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_GREEN, HSV_BLACK), 0);
+    EXPECT_EQ(converted(), 2 * per_palette);
+
+    // Cyan is now the least recently used, so is evicted by yellow
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_YELLOW, HSV_BLACK), 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_GREEN, HSV_BLACK), 0);
+    EXPECT_EQ(converted(), 3 * per_palette);
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_CYAN, HSV_BLACK), 0);
+    EXPECT_EQ(converted(), 4 * per_palette);
+}
+
+/**
+ * This test verifies that palettes are cached per device, as each may have a different native pixel format.
+ */
+TEST_F(PainterPalette, PerDevice_Cached) {
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_ORANGE, HSV_BLACK), 0);
+    std::uint32_t per_palette = converted();
+    EXPECT_GT(qp_drawtext_recolor(surface, 0, 0, font, "A", HSV_ORANGE, HSV_BLACK), 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "A", HSV_ORANGE, HSV_BLACK), 0);
+    EXPECT_EQ(converted(), per_palette) << "Switching devices should have reused the panel's cached palette";
+}
@@ -0,0 +1,233 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+// Geometry of the virtual panel and surfaces used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 64>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 64>;
+
+// Rects drawn by the row-at-a-time filled circles and ellipses that preceded the span rasterizer, used as a reference
+// for both the pixels drawn and the number of bus transactions required
+struct Rect {
+    int l, t, r, b;
+};
+
+static std::vector<Rect> legacy_filled_circle(int cx, int cy, int radius) {
+    std::vector<Rect> rects;
+    auto              row   = [&](int x1, int x2, int y) { rects.push_back({std::min(x1, x2), y, std::max(x1, x2), y}); };
+    auto              point = [&](int x, int y) { rects.push_back({x, y, x, y}); };
+    auto              plot  = [&](int ox, int oy) {
+        if (ox == 0) {
+            point(cx, cy + oy), point(cx, cy - oy), row(cx + oy, cx - oy, cy);
+        } else if (ox == oy) {
+            row(cx + oy, cx - oy, cy + oy), row(cx + oy, cx - oy, cy - oy);
+        } else {
+            row(cx + ox, cx - ox, cy + oy), row(cx + ox, cx - ox, cy - oy), row(cx + oy, cx - oy, cy + ox), row(cx + oy, cx - oy, cy - ox);
+        }
+    };
+
+    int x = 0, y = radius, err = ((5 - (radius >> 2)) >> 2);
+    plot(x, y);
+    while (x < y) {
+        x++;
+        if (err < 0) {
+            err += (x << 1) + 1;
+        } else {
+            y--;
+            err += ((x - y) << 1) + 1;
+        }
+        plot(x, y);
+    }
+    return rects;
+}
+
+static std::vector<Rect> legacy_filled_ellipse(int cx, int cy, int sizex, int sizey) {
+    std::vector<Rect> rects;
+    auto              plot = [&](int ox, int oy) {
+        if (ox == 0) {
+            rects.push_back({cx, cy + oy, cx, cy + oy}), rects.push_back({cx, cy - oy, cx, cy - oy});
+        } else {
+            rects.push_back({cx - ox, cy + oy, cx + ox, cy + oy});
+            if (oy > 0) {
+                rects.push_back({cx - ox, cy - oy, cx + ox, cy - oy});
+            }
+        }
+    };
+
+    std::int32_t aa = sizex * sizex, bb = sizey * sizey, fa = 4 * aa, fb = 4 * bb;
+    int          dx = 0, dy = sizey;
+    for (std::int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+    dx = sizex, dy = 0;
+    for (std::int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+    return rects;
+}
+
+class PainterRaster : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel and surfaces are used across all tests
+        device       = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+        surface      = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, surface_buffer);
+        mono_surface = qp_make_mono1bpp_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, mono_surface_buffer);
+    }
+
+    void SetUp() override {
+        for (painter_device_t d : {device, surface, mono_surface}) {
+            ASSERT_NE(d, nullptr) << "Failed to create device";
+            ASSERT_TRUE(qp_init(d, QP_ROTATION_0)) << "Failed to initialise device";
+            ASSERT_TRUE(qp_rect(d, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLACK, true));
+        }
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    static painter_device_t device;
+    static painter_device_t surface;
+    static painter_device_t mono_surface;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     mono_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    // Verifies the panel holds exactly the pixels covered by the reference rects, and reports the transactions saved
+    void expect_matches_legacy(const char* shape, const std::vector<Rect>& legacy) {
+        std::vector<bool> expected(PANEL_WIDTH::value * PANEL_HEIGHT::value, false);
+        std::uint32_t     legacy_pixels = 0;
+        for (const Rect& rect : legacy) {
+            for (int y = rect.t; y <= rect.b; ++y) {
+                for (int x = rect.l; x <= rect.r; ++x) {
+                    expected[y * PANEL_WIDTH::value + x] = true;
+                    ++legacy_pixels;
+                }
+            }
+        }
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y) != 0, expected[y * PANEL_WIDTH::value + x]) << shape << ": unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+
+        std::cout << "[          ] " << shape << ": viewports " << legacy.size() << " -> " << stats().viewport_count << ", pixels sent " << legacy_pixels << " -> " << stats().pixdata_bytes / 2 << std::endl;
+        EXPECT_LE(stats().viewport_count, legacy.size()) << shape << ": expected no more bus transactions than the row-at-a-time reference";
+        EXPECT_LE(stats().pixdata_bytes / 2, legacy_pixels) << shape << ": expected no more pixels sent than the row-at-a-time reference";
+        legacy_viewports += legacy.size();
+        viewports += stats().viewport_count;
+    }
+
+    std::uint32_t legacy_viewports = 0;
+    std::uint32_t viewports        = 0;
+
+    // Retrieves the RGB565 value of a surface pixel, as it would be displayed
+    static std::uint16_t surface_pixel(std::uint16_t x, std::uint16_t y) {
+        // Surfaces hold pixels in transmission order, i.e. big-endian
+        return __builtin_bswap16(((const std::uint16_t*)surface_buffer)[y * PANEL_WIDTH::value + x]);
+    }
+};
+
+painter_device_t PainterRaster::device       = nullptr;
+painter_device_t PainterRaster::surface      = nullptr;
+painter_device_t PainterRaster::mono_surface = nullptr;
+std::uint8_t     PainterRaster::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterRaster::surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterRaster::mono_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+
+/**
+ * This test verifies that filled circles draw the same pixels as before, with fewer and smaller transfers.
+ */
+TEST_F(PainterRaster, FilledCircle_CoalescedSpans) {
+    for (std::uint16_t radius : {1, 2, 5, 12, 25, 30}) {
+        SetUp();
+        ASSERT_TRUE(qp_circle(device, 32, 32, radius, HSV_WHITE, true));
+        expect_matches_legacy(("circle r=" + std::to_string(radius)).c_str(), legacy_filled_circle(32, 32, radius));
+    }
+    EXPECT_LT(viewports * 2, legacy_viewports) << "Expected less than half the bus transactions overall";
+}
+
+/**
+ * This test verifies that filled ellipses draw the same pixels as before, with fewer and smaller transfers.
+ */
+TEST_F(PainterRaster, FilledEllipse_CoalescedSpans) {
+    for (std::array<std::uint16_t, 2> size : {std::array<std::uint16_t, 2>{3, 1}, {20, 8}, {8, 20}, {12, 22}, {30, 30}}) {
+        SetUp();
+        ASSERT_TRUE(qp_ellipse(device, 32, 32, size[0], size[1], HSV_WHITE, true));
+        expect_matches_legacy(("ellipse " + std::to_string(size[0]) + "x" + std::to_string(size[1])).c_str(), legacy_filled_ellipse(32, 32, size[0], size[1]));
+    }
+    EXPECT_LT(viewports * 2, legacy_viewports) << "Expected less than half the bus transactions overall";
+}
+
+/**
+ * This test verifies that anti-aliased filled circles are solid in the middle, blended at the edges, and symmetric.
+ */
+TEST_F(PainterRaster, AntiAliasedCircle_BlendsEdges) {
+    ASSERT_TRUE(qp_surface_circle_aa(surface, 32, 32, 10, HSV_WHITE, true));
+
+    std::uint32_t partial = 0;
+    double        area    = 0;
+    for (int y = 0; y < PANEL_HEIGHT::value; ++y) {
+        for (int x = 0; x < PANEL_WIDTH::value; ++x) {
+            std::uint16_t pixel = surface_pixel(x, y);
+            ASSERT_EQ(pixel, surface_pixel(64 - x < PANEL_WIDTH::value ? 64 - x : x, y)) << "Expected horizontal symmetry at (" << x << ", " << y << ")";
+            ASSERT_EQ(pixel, surface_pixel(x, 64 - y < PANEL_HEIGHT::value ? 64 - y : y)) << "Expected vertical symmetry at (" << x << ", " << y << ")";
+            if (pixel != 0 && pixel != 0xFFFF) {
+                ++partial;
+            }
+            area += (pixel >> 11) / 31.0;
+        }
+    }
+
+    EXPECT_EQ(surface_pixel(32, 32), 0xFFFF);
+    EXPECT_EQ(surface_pixel(32, 22), 0xFFFF) << "The aliased extent should be covered";
+    EXPECT_EQ(surface_pixel(32, 20), 0x0000);
+    EXPECT_GT(partial, 0) << "Edge pixels should have been blended";
+    EXPECT_NEAR(area, 3.14159 * 10.5 * 10.5, 3.0) << "Coverage should approximate the area of the circle";
+}
+
+/**
+ * This test verifies that anti-aliased outlines leave the inside of the shape untouched.
+ */
+TEST_F(PainterRaster, AntiAliasedEllipse_Outline) {
+    ASSERT_TRUE(qp_surface_ellipse_aa(surface, 32, 32, 20, 10, HSV_WHITE, false));
+
+    EXPECT_EQ(surface_pixel(32, 32), 0x0000);
+    EXPECT_EQ(surface_pixel(45, 32), 0x0000);
+    EXPECT_EQ(surface_pixel(52, 32), 0xFFFF);
+    EXPECT_EQ(surface_pixel(12, 32), 0xFFFF);
+    EXPECT_EQ(surface_pixel(32, 42), 0xFFFF);
+    EXPECT_EQ(surface_pixel(32, 22), 0xFFFF);
+    EXPECT_EQ(surface_pixel(54, 32), 0x0000);
+}
+
+/**
+ * This test verifies that anti-aliased shapes are rejected by anything other than RGB565 surfaces.
+ */
+TEST_F(PainterRaster, AntiAliased_RequiresRgb565Surface) {
+    EXPECT_FALSE(qp_surface_circle_aa(mono_surface, 32, 32, 10, HSV_WHITE, true));
+    EXPECT_FALSE(qp_surface_circle_aa(device, 32, 32, 10, HSV_WHITE, true));
+}
@@ -0,0 +1,230 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_surface.h"
+#include "graphics/lock-caps-ON.qgf.h"
+#include "graphics/thintel15.qff.h"
+}
+
+// Geometry of the virtual panel used for all scenes
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 128>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 96>;
+
+// Number of repetitions used when timing each primitive
+using BENCH_ITERATIONS = std::integral_constant<int, 200>;
+
+class PainterRender : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel is used across all tests
+        device = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+    }
+
+    void SetUp() override {
+        ASSERT_NE(device, nullptr) << "Failed to create virtual panel";
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0)) << "Failed to initialise virtual panel";
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    static painter_device_t device;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    // FNV-1a 64-bit hash of the RGB565 contents of the panel, in row-major order
+    std::uint64_t framebuffer_hash() {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                std::uint16_t pixel = qp_virtual_panel_get_pixel(device, x, y);
+                for (std::uint8_t byte : {(std::uint8_t)(pixel >> 8), (std::uint8_t)(pixel & 0xFF)}) {
+                    hash ^= byte;
+                    hash *= 0x100000001b3ULL;
+                }
+            }
+        }
+        return hash;
+    }
+
+    // Writes the contents of the panel as a PPM image, so that mismatches can be inspected
+    std::string dump_ppm(const std::string& name) {
+        std::string   path = ::testing::TempDir() + "painter_render_" + name + ".ppm";
+        std::ofstream out(path, std::ios::binary);
+        out << "P6\n" << PANEL_WIDTH::value << " " << PANEL_HEIGHT::value << "\n255\n";
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                std::uint16_t pixel = qp_virtual_panel_get_pixel(device, x, y);
+                out.put((char)(((pixel >> 11) & 0x1F) << 3));
+                out.put((char)(((pixel >> 5) & 0x3F) << 2));
+                out.put((char)((pixel & 0x1F) << 3));
+            }
+        }
+        return path;
+    }
+
+    // Golden images are stored as hashes of the expected panel contents -- on mismatch the rendered image is written out,
+    // so it can be inspected and the golden hash updated if the change in output is intended
+    void expect_golden(const std::string& name, std::uint64_t golden_hash) {
+        std::uint64_t hash = framebuffer_hash();
+        if (hash != golden_hash) {
+            std::string path = dump_ppm(name);
+            ADD_FAILURE() << "Scene '" << name << "' does not match its golden image: got 0x" << std::hex << std::setw(16) << std::setfill('0') << hash << ", rendered output written to " << path;
+        }
+    }
+
+    // Times repeated invocations of a single primitive, reporting CPU time and bytes sent to the panel per invocation
+    void bench(const std::string& name, const std::function<void()>& primitive) {
+        qp_virtual_panel_reset_stats(device);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCH_ITERATIONS::value; ++i) {
+            primitive();
+        }
+        auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        auto s       = stats();
+
+        std::cout << "[ BENCH    ] " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(2) << std::setw(10) << (elapsed / BENCH_ITERATIONS::value) << "us " << std::setw(8) << (s.bytes_sent / BENCH_ITERATIONS::value) << " bytes " << std::setw(6) << (s.command_count / BENCH_ITERATIONS::value) << " cmds " << std::setw(6) << (s.viewport_count / BENCH_ITERATIONS::value) << " viewports" << std::endl;
+        EXPECT_GT(s.bytes_sent, 0) << "Primitive '" << name << "' did not send anything to the panel";
+    }
+};
+
+painter_device_t PainterRender::device = nullptr;
+std::uint8_t     PainterRender::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+
+/**
+ * This test verifies that the virtual panel decodes the window and pixel data sent by the TFT panel routines.
+ */
+TEST_F(PainterRender, FilledRect_WindowAndBytes) {
+    EXPECT_TRUE(qp_rect(device, 10, 20, 29, 24, HSV_RED, true)) << "Failed to draw rect";
+
+    for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+        for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+            bool inside = x >= 10 && x <= 29 && y >= 20 && y <= 24;
+            ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), inside ? 0xF800 : 0x0000) << "Unexpected pixel at (" << x << ", " << y << ")";
+        }
+    }
+
+    // Column and row addresses (command + 4 bytes each), then the memory write command and 20x5 RGB565 pixels
+    auto s = stats();
+    EXPECT_EQ(s.viewport_count, 1) << "Expected a single viewport";
+    EXPECT_EQ(s.pixdata_bytes, 20 * 5 * 2) << "Unexpected amount of pixel data";
+    EXPECT_EQ(s.bytes_sent, 5 + 5 + 1 + 20 * 5 * 2) << "Unexpected number of bytes sent";
+}
+
+/**
+ * This test verifies that pixel data wraps around within the window, as it would on a real panel.
+ */
+TEST_F(PainterRender, Pixdata_WrapsWithinViewport) {
+    const std::uint16_t pixels[] = {0x1234, 0x5678, 0x9ABC, 0xDEF0, 0x0FED, 0xCBA9};
+    std::uint16_t       swapped[6];
+    for (size_t i = 0; i < 6; ++i) {
+        swapped[i] = __builtin_bswap16(pixels[i]);
+    }
+
+    EXPECT_TRUE(qp_viewport(device, 4, 4, 5, 5)) << "Failed to set viewport";
+    EXPECT_TRUE(qp_pixdata(device, swapped, 6)) << "Failed to send pixel data";
+
+    // 6 pixels into a 2x2 window -- the last two overwrite the first row
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 4, 4), pixels[4]);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 5, 4), pixels[5]);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 4, 5), pixels[2]);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 5, 5), pixels[3]);
+}
+
+/**
+ * Reference scene: rectangles, lines and individual pixels.
+ */
+TEST_F(PainterRender, Scene_Primitives) {
+    EXPECT_TRUE(qp_rect(device, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLUE, false));
+    EXPECT_TRUE(qp_rect(device, 8, 8, 40, 30, HSV_GREEN, true));
+    EXPECT_TRUE(qp_rect(device, 50, 8, 90, 30, HSV_YELLOW, false));
+    EXPECT_TRUE(qp_line(device, 4, 40, 123, 40, HSV_WHITE));
+    EXPECT_TRUE(qp_line(device, 64, 44, 64, 91, HSV_CYAN));
+    EXPECT_TRUE(qp_line(device, 4, 91, 60, 44, HSV_MAGENTA));
+    EXPECT_TRUE(qp_line(device, 70, 44, 123, 91, HSV_ORANGE));
+    for (std::uint16_t i = 0; i < 16; ++i) {
+        EXPECT_TRUE(qp_setpixel(device, 100 + i, 8 + i, i * 16, 255, 255));
+    }
+    expect_golden("primitives", 0xcc7635aac96ccc9bULL);
+}
+
+/**
+ * Reference scene: circles and ellipses.
+ */
+TEST_F(PainterRender, Scene_CirclesEllipses) {
+    EXPECT_TRUE(qp_circle(device, 24, 24, 20, HSV_RED, false));
+    EXPECT_TRUE(qp_circle(device, 24, 24, 12, HSV_GOLD, true));
+    EXPECT_TRUE(qp_circle(device, 100, 70, 25, HSV_TEAL, true));
+    EXPECT_TRUE(qp_ellipse(device, 64, 24, 30, 10, HSV_PURPLE, false));
+    EXPECT_TRUE(qp_ellipse(device, 40, 70, 12, 22, HSV_SPRINGGREEN, true));
+    expect_golden("circles_ellipses", 0x482a01be006aa928ULL);
+}
+
+/**
+ * Reference scene: RLE-encoded mono4 image, drawn normally and recoloured.
+ */
+TEST_F(PainterRender, Scene_Images) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_lock_caps_ON);
+    ASSERT_NE(image, nullptr) << "Failed to load image";
+    EXPECT_EQ(image->width, 32);
+    EXPECT_EQ(image->height, 32);
+
+    EXPECT_TRUE(qp_drawimage(device, 4, 4, image));
+    EXPECT_TRUE(qp_drawimage_recolor(device, 48, 4, image, HSV_RED, HSV_BLUE));
+    EXPECT_TRUE(qp_drawimage_recolor(device, 92, 60, image, HSV_CHARTREUSE, HSV_BLACK));
+    EXPECT_TRUE(qp_close_image(image));
+    expect_golden("images", 0x2ad9e08102673d21ULL);
+}
+
+/**
+ * Reference scene: text rendered with a mono2 font.
+ */
+TEST_F(PainterRender, Scene_Text) {
+    painter_font_handle_t font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    EXPECT_GT(qp_drawtext(device, 2, 2, font, "Quantum Painter"), 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 2, 2 + font->line_height, font, "WPM: 123", HSV_GREEN, HSV_BLACK), 0);
+    EXPECT_GT(qp_drawtext_recolor(device, 2, 2 + 2 * font->line_height, font, "Layer: Lower", HSV_WHITE, HSV_AZURE), 0);
+    EXPECT_EQ(qp_textwidth(font, "Quantum Painter"), qp_drawtext(device, 2, 60, font, "Quantum Painter"));
+    EXPECT_TRUE(qp_close_font(font));
+    expect_golden("text", 0x1aaef18e32d7eb53ULL);
+}
+
+/**
+ * Benchmark: CPU time and bytes sent to the panel per primitive.
+ */
+TEST_F(PainterRender, PrimitiveCost) {
+    painter_image_handle_t image = qp_load_image_mem(gfx_lock_caps_ON);
+    painter_font_handle_t  font  = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(image, nullptr) << "Failed to load image";
+    ASSERT_NE(font, nullptr) << "Failed to load font";
+
+    bench("qp_setpixel", [] { qp_setpixel(device, 10, 10, HSV_WHITE); });
+    bench("qp_line (horizontal)", [] { qp_line(device, 0, 10, 127, 10, HSV_WHITE); });
+    bench("qp_line (diagonal)", [] { qp_line(device, 0, 0, 95, 95, HSV_WHITE); });
+    bench("qp_rect (outline)", [] { qp_rect(device, 0, 0, 127, 95, HSV_WHITE, false); });
+    bench("qp_rect (filled)", [] { qp_rect(device, 0, 0, 127, 95, HSV_WHITE, true); });
+    bench("qp_circle (outline)", [] { qp_circle(device, 48, 48, 40, HSV_WHITE, false); });
+    bench("qp_circle (filled)", [] { qp_circle(device, 48, 48, 40, HSV_WHITE, true); });
+    bench("qp_ellipse (outline)", [] { qp_ellipse(device, 64, 48, 60, 30, HSV_WHITE, false); });
+    bench("qp_ellipse (filled)", [] { qp_ellipse(device, 64, 48, 60, 30, HSV_WHITE, true); });
+    bench("qp_drawimage", [image] { qp_drawimage(device, 0, 0, image); });
+    bench("qp_drawimage_recolor", [image] { qp_drawimage_recolor(device, 0, 0, image, HSV_RED, HSV_BLUE); });
+    bench("qp_drawtext", [font] { qp_drawtext(device, 0, 0, font, "Quantum Painter"); });
+
+    EXPECT_TRUE(qp_close_image(image));
+    EXPECT_TRUE(qp_close_font(font));
+}
@@ -0,0 +1,181 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+// Geometry of the virtual panel and surfaces used for all tests
+using PANEL_WIDTH  = std::integral_constant<std::uint16_t, 64>;
+using PANEL_HEIGHT = std::integral_constant<std::uint16_t, 32>;
+
+// Number of bytes sent for a full dirty tile
+using TILE_BYTES = std::integral_constant<std::uint32_t, SURFACE_DIRTY_TILE_SIZE * SURFACE_DIRTY_TILE_SIZE * 2>;
+
+class PainterSurface : public ::testing::Test {
+   protected:
+    static void SetUpTestSuite() {
+        // Devices can't be released, so the same virtual panel and surfaces are used across all tests
+        device       = qp_virtual_panel_make_device(PANEL_WIDTH::value, PANEL_HEIGHT::value, gram);
+        surface      = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, surface_buffer);
+        overlay      = qp_make_rgb565_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, overlay_buffer);
+        mono_surface = qp_make_mono1bpp_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, mono_surface_buffer);
+        mono_target  = qp_make_mono1bpp_surface(PANEL_WIDTH::value, PANEL_HEIGHT::value, mono_target_buffer);
+    }
+
+    void SetUp() override {
+        for (painter_device_t d : {device, surface, overlay, mono_surface, mono_target}) {
+            ASSERT_NE(d, nullptr) << "Failed to create device";
+            ASSERT_TRUE(qp_init(d, QP_ROTATION_0)) << "Failed to initialise device";
+        }
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    static painter_device_t device;
+    static painter_device_t surface;
+    static painter_device_t overlay;
+    static painter_device_t mono_surface;
+    static painter_device_t mono_target;
+    static std::uint8_t     gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     overlay_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+    static std::uint8_t     mono_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+    static std::uint8_t     mono_target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+
+    qp_virtual_panel_stats_t stats() {
+        qp_virtual_panel_stats_t s;
+        qp_virtual_panel_get_stats(device, &s);
+        return s;
+    }
+
+    // Sends the whole surface to the panel, so that subsequent draws only send what's changed since
+    void sync(painter_device_t s) {
+        ASSERT_TRUE(qp_surface_draw(s, device, 0, 0, true));
+        qp_virtual_panel_reset_stats(device);
+    }
+
+    // Retrieves the RGB565 value of a surface pixel, as it would be displayed
+    static std::uint16_t surface_pixel(const std::uint8_t* buffer, std::uint16_t x, std::uint16_t y) {
+        // Surfaces hold pixels in transmission order, i.e. big-endian
+        return __builtin_bswap16(((const std::uint16_t*)buffer)[y * PANEL_WIDTH::value + x]);
+    }
+
+    // Verifies the virtual panel matches the surface
+    void expect_matches_surface(const std::uint8_t* buffer) {
+        for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+            for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+                ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), surface_pixel(buffer, x, y)) << "Unexpected pixel at (" << x << ", " << y << ")";
+            }
+        }
+    }
+};
+
+painter_device_t PainterSurface::device       = nullptr;
+painter_device_t PainterSurface::surface      = nullptr;
+painter_device_t PainterSurface::overlay      = nullptr;
+painter_device_t PainterSurface::mono_surface = nullptr;
+painter_device_t PainterSurface::mono_target  = nullptr;
+std::uint8_t     PainterSurface::gram[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterSurface::surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterSurface::overlay_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 16)];
+std::uint8_t     PainterSurface::mono_surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+std::uint8_t     PainterSurface::mono_target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH::value, PANEL_HEIGHT::value, 1)];
+
+/**
+ * This test verifies that changes in opposite corners only send the two dirty tiles, not the area between them.
+ */
+TEST_F(PainterSurface, ScatteredChanges_OnlyDirtyTilesSent) {
+    sync(surface);
+    qp_setpixel(surface, 0, 0, HSV_RED);
+    qp_setpixel(surface, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_GREEN);
+    ASSERT_TRUE(qp_surface_draw(surface, device, 0, 0, false));
+
+    expect_matches_surface(surface_buffer);
+    EXPECT_EQ(stats().viewport_count, 2);
+    EXPECT_EQ(stats().pixdata_bytes, 2 * TILE_BYTES::value);
+}
+
+/**
+ * This test verifies that dirty tiles are clipped to the dirty region.
+ */
+TEST_F(PainterSurface, SinglePixel_ClippedToDirtyRegion) {
+    sync(surface);
+    qp_setpixel(surface, 20, 5, HSV_RED);
+    ASSERT_TRUE(qp_surface_draw(surface, device, 0, 0, false));
+
+    expect_matches_surface(surface_buffer);
+    EXPECT_EQ(stats().viewport_count, 1);
+    EXPECT_EQ(stats().pixdata_bytes, 2);
+}
+
+/**
+ * This test verifies that adjacent dirty tiles are merged into a single transfer.
+ */
+TEST_F(PainterSurface, AdjacentTiles_Merged) {
+    sync(surface);
+    qp_rect(surface, 10, 10, 40, 20, HSV_BLUE, true);
+    ASSERT_TRUE(qp_surface_draw(surface, device, 0, 0, false));
+
+    expect_matches_surface(surface_buffer);
+    EXPECT_EQ(stats().viewport_count, 1);
+    EXPECT_EQ(stats().pixdata_bytes, 31 * 11 * 2);
+
+    // Nothing further to send
+    qp_virtual_panel_reset_stats(device);
+    ASSERT_TRUE(qp_surface_draw(surface, device, 0, 0, false));
+    EXPECT_EQ(stats().viewport_count, 0);
+}
+
+/**
+ * This test verifies that mono1bpp surfaces can be drawn to other mono1bpp devices.
+ */
+TEST_F(PainterSurface, Mono1bpp_DrawToMono1bpp) {
+    ASSERT_TRUE(qp_surface_draw(mono_surface, mono_target, 0, 0, true));
+    qp_rect(mono_surface, 3, 1, 45, 17, HSV_WHITE, true);
+    qp_line(mono_surface, 0, 31, 63, 0, HSV_WHITE);
+    qp_setpixel(mono_surface, 5, 5, HSV_BLACK);
+    ASSERT_TRUE(qp_surface_draw(mono_surface, mono_target, 0, 0, false));
+
+    EXPECT_EQ(0, memcmp(mono_surface_buffer, mono_target_buffer, sizeof(mono_target_buffer))) << "Target surface should match the source surface";
+}
+
+/**
+ * This test verifies that layers are composited respecting transparency, and that only dirty tiles are resent.
+ */
+TEST_F(PainterSurface, Compose_LayersWithTransparency) {
+    painter_device_t layers[] = {surface, overlay};
+    ASSERT_TRUE(qp_surface_set_transparent_color(overlay, HSV_BLACK));
+    qp_rect(surface, 0, 0, PANEL_WIDTH::value - 1, PANEL_HEIGHT::value - 1, HSV_BLUE, true);
+    qp_rect(overlay, 8, 8, 23, 23, HSV_RED, true);
+    ASSERT_TRUE(qp_surface_compose(layers, 2, device, 0, 0, true));
+
+    for (std::uint16_t y = 0; y < PANEL_HEIGHT::value; ++y) {
+        for (std::uint16_t x = 0; x < PANEL_WIDTH::value; ++x) {
+            bool in_overlay = x >= 8 && x <= 23 && y >= 8 && y <= 23;
+            ASSERT_EQ(qp_virtual_panel_get_pixel(device, x, y), surface_pixel(in_overlay ? overlay_buffer : surface_buffer, x, y)) << "Unexpected pixel at (" << x << ", " << y << ")";
+        }
+    }
+    EXPECT_EQ(stats().viewport_count, 1);
+
+    // Changes beneath an opaque overlay pixel are hidden, but only the dirty region is sent
+    qp_virtual_panel_reset_stats(device);
+    qp_setpixel(surface, 10, 10, HSV_GREEN);
+    qp_setpixel(overlay, 50, 20, HSV_WHITE);
+    ASSERT_TRUE(qp_surface_compose(layers, 2, device, 0, 0, false));
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 10, 10), surface_pixel(overlay_buffer, 10, 10));
+    EXPECT_EQ(qp_virtual_panel_get_pixel(device, 50, 20), 0xFFFF);
+    EXPECT_EQ(stats().viewport_count, 2);
+    EXPECT_EQ(stats().pixdata_bytes, (6 * 6 + 3 * 5) * 2) << "Only the dirty tiles, clipped to the dirty region, should have been sent";
+
+    // Nothing further to send
+    qp_virtual_panel_reset_stats(device);
+    ASSERT_TRUE(qp_surface_compose(layers, 2, device, 0, 0, false));
+    EXPECT_EQ(stats().viewport_count, 0);
+
+    // Mismatched layers are rejected
+    painter_device_t mismatched[] = {surface, mono_surface};
+    EXPECT_FALSE(qp_surface_compose(mismatched, 2, device, 0, 0, true));
+}
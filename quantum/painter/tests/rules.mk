@@ -0,0 +1,159 @@
+painter_common_DEFS := \
+	-DMATRIX_ROWS=1 \
+	-DMATRIX_COLS=1 \
+	-DNO_DEBUG \
+	-DNO_PRINT \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DQUANTUM_PAINTER_VIRTUAL_PANEL_ENABLE \
+	-DQUANTUM_PAINTER_DISPLAY_TIMEOUT=0
+painter_common_SRC := \
+	$(QUANTUM_PATH)/painter/tests/graphics/lock-caps-ON.qgf.c \
+	$(QUANTUM_PATH)/painter/tests/graphics/thintel15.qff.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_internal.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/painter/qp_virtual_panel.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+painter_common_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/painter/tests \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/comms \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/tft_panel \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/painter
+
+painter_render_DEFS := \
+	$(painter_common_DEFS)
+painter_render_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_render.cpp
+painter_render_INC := \
+	$(painter_common_INC)
+
+painter_glyph_cache_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_SIZE=512 \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_ENTRIES=8
+painter_glyph_cache_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_glyph_cache.cpp
+painter_glyph_cache_INC := \
+	$(painter_common_INC)
+
+painter_animation_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK=64
+painter_animation_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_animation.cpp
+painter_animation_INC := \
+	$(painter_common_INC)
+
+painter_async_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_PIXDATA_BUFFER_SIZE=64 \
+	-DQUANTUM_PAINTER_PIXDATA_BUFFER_COUNT=2 \
+	-DSURFACE_NUM_DEVICES=2
+painter_async_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_async.cpp
+painter_async_INC := \
+	$(painter_common_INC)
+
+painter_surface_DEFS := \
+	$(painter_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=5
+painter_surface_SRC := \
+	$(painter_common_SRC) \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(QUANTUM_PATH)/painter/tests/painter_surface.cpp
+painter_surface_INC := \
+	$(painter_common_INC)
+
+painter_lz_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_SUPPORTS_LZ_COMPRESSION=1 \
+	-DQUANTUM_PAINTER_ANIMATION_PIXELS_PER_TICK=256
+painter_lz_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_lz.cpp
+painter_lz_INC := \
+	$(painter_common_INC)
+
+painter_palette_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_PALETTE_CACHE_ENTRIES=2
+painter_palette_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_palette.cpp
+painter_palette_INC := \
+	$(painter_common_INC)
+
+painter_raster_DEFS := \
+	$(painter_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=2
+painter_raster_SRC := \
+	$(painter_common_SRC) \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(QUANTUM_PATH)/painter/tests/painter_raster.cpp
+painter_raster_INC := \
+	$(painter_common_INC)
+
+painter_flash_DEFS := \
+	$(painter_common_DEFS) \
+	-DFLASH_ENABLE \
+	-DQUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE=64
+painter_flash_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/painter_flash.cpp
+painter_flash_INC := \
+	$(painter_common_INC) \
+	$(DRIVER_PATH)/flash
+
+painter_lvgl_common_DEFS := \
+	$(painter_common_DEFS) \
+	-DQUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
+painter_lvgl_common_SRC := \
+	$(painter_common_SRC) \
+	$(QUANTUM_PATH)/painter/lvgl/qp_lvgl.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/painter/lvgl/lvgl_stub.c \
+	$(QUANTUM_PATH)/painter/tests/painter_lvgl.cpp
+painter_lvgl_common_INC := \
+	$(painter_common_INC) \
+	$(QUANTUM_PATH)/painter/lvgl \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/painter/lvgl
+
+painter_lvgl_DEFS := \
+	$(painter_lvgl_common_DEFS)
+painter_lvgl_SRC := \
+	$(painter_lvgl_common_SRC)
+painter_lvgl_INC := \
+	$(painter_lvgl_common_INC)
+
+painter_lvgl_single_DEFS := \
+	$(painter_lvgl_common_DEFS) \
+	-DQP_LVGL_BUFFER_COUNT=1
+painter_lvgl_single_SRC := \
+	$(painter_lvgl_common_SRC)
+painter_lvgl_single_INC := \
+	$(painter_lvgl_common_INC)
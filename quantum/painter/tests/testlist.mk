@@ -0,0 +1,12 @@
+TEST_LIST += \
+	painter_render \
+	painter_glyph_cache \
+	painter_animation \
+	painter_async \
+	painter_surface \
+	painter_lz \
+	painter_palette \
+	painter_raster \
+	painter_flash \
+	painter_lvgl \
+	painter_lvgl_single
@@ -21,6 +21,11 @@
 #include "timer.h"
 #include "gpio.h"
 
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+#    include "atomic_util.h"
+#    include "synchronization_util.h"
+#endif
+
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
@@ -43,18 +48,52 @@
 #    include "transactions.h"
 #    include "keyboard.h"
 
-report_mouse_t shared_mouse_report = {};
-uint16_t       shared_cpi          = 0;
+report_mouse_t                       shared_mouse_report = {};
+uint16_t                             shared_cpi          = 0;
+static pointing_device_accumulator_t shared_accumulator  = {};
+#    if defined(POINTING_DEVICE_ACCEL_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+static pointing_device_accel_state_t shared_accel_state = {};
+#    endif
 
 /**
  * @brief Sets the shared mouse report used be pointing device task
  *
+ * Replaces any motion from the target side that has not yet been consumed by pointing device task.
+ *
  * NOTE : Only available when using SPLIT_POINTING_ENABLE
  *
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
-    shared_mouse_report = new_mouse_report;
+    uint32_t timestamp = shared_accumulator.timestamp;
+    memset(&shared_accumulator, 0, sizeof(shared_accumulator));
+    pointing_device_accumulator_add(&shared_accumulator, new_mouse_report, timestamp);
+}
+
+/**
+ * @brief Adds motion to the shared mouse report used be pointing device task
+ *
+ * Motion is accumulated until it is consumed by pointing device task, so reports received from the target side more
+ * often than the pointing device task runs are not lost.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] new_mouse_report report_mouse_t
+ * @param[in] timestamp sync timer time the motion was sampled at
+ */
+void pointing_device_add_shared_report(report_mouse_t new_mouse_report, uint32_t timestamp) {
+    pointing_device_accumulator_add(&shared_accumulator, new_mouse_report, timestamp);
+}
+
+/**
+ * @brief Gets the time of the most recent motion sample received from the target side
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @return sync timer time as uint32_t
+ */
+uint32_t pointing_device_get_shared_timestamp(void) {
+    return shared_accumulator.timestamp;
 }
 
 /**
@@ -88,6 +127,14 @@ static pointing_device_status_t pointing_device_status     = POINTING_DEVICE_STA
 static uint16_t hires_scroll_resolution;
 #endif
 
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+static pointing_device_accumulator_t sample_accumulator = {};
+#endif
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+static pointing_device_accel_state_t accel_state = {};
+#endif
+
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
 
@@ -194,8 +241,18 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+        // Cached so the sensor is not queried for every report -- read before background sampling starts, so unlocked
+        accel_state.cpi = pointing_device_driver->get_cpi();
+#endif
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+        pointing_device_sampling_init();
 #endif
     }
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    pointing_device_accel_init();
+#endif
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
     hires_scroll_resolution = POINTING_DEVICE_HIRES_SCROLL_MULTIPLIER;
     for (int i = 0; i < POINTING_DEVICE_HIRES_SCROLL_EXPONENT; i++) {
@@ -230,6 +287,147 @@ void pointing_device_set_status(pointing_device_status_t status) {
     pointing_device_status = status;
 }
 
+/**
+ * @brief Adds a mouse report to a motion accumulator
+ *
+ * Motion is summed into 32-bit accumulators so that it can be sampled faster than it is reported without loss.
+ * Buttons pressed since the accumulator was last drained are latched, so short clicks are never missed.
+ *
+ * @param[in] accumulator pointing_device_accumulator_t to add to
+ * @param[in] mouse_report report_mouse_t sampled from a sensor
+ * @param[in] timestamp time the report was sampled at
+ */
+void pointing_device_accumulator_add(pointing_device_accumulator_t *accumulator, report_mouse_t mouse_report, uint32_t timestamp) {
+    accumulator->x += mouse_report.x;
+    accumulator->y += mouse_report.y;
+    accumulator->v += mouse_report.v;
+    accumulator->h += mouse_report.h;
+
+    accumulator->buttons_pressed |= mouse_report.buttons;
+
+    accumulator->buttons   = mouse_report.buttons;
+    accumulator->timestamp = timestamp;
+}
+
+static inline int32_t pointing_device_accumulator_take(int32_t *value, int32_t min, int32_t max) {
+    int32_t taken = *value < min ? min : (*value > max ? max : *value);
+    *value -= taken;
+    return taken;
+}
+
+/**
+ * @brief Drains a motion accumulator into a mouse report
+ *
+ * Takes as much motion as fits in the mouse report, leaving any remainder in the accumulator for the next report.
+ *
+ * @param[in] accumulator pointing_device_accumulator_t to drain
+ * @return report_mouse_t containing the drained motion
+ */
+report_mouse_t pointing_device_accumulator_drain(pointing_device_accumulator_t *accumulator) {
+    report_mouse_t mouse_report   = {0};
+    mouse_report.x                = pointing_device_accumulator_take(&accumulator->x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y                = pointing_device_accumulator_take(&accumulator->y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.v                = pointing_device_accumulator_take(&accumulator->v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.h                = pointing_device_accumulator_take(&accumulator->h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.buttons          = accumulator->buttons | accumulator->buttons_pressed;
+    accumulator->buttons_pressed  = 0;
+    accumulator->buttons_reported = mouse_report.buttons;
+    return mouse_report;
+}
+
+/**
+ * @brief Checks whether a motion accumulator holds anything not yet drained
+ *
+ * @param[in] accumulator pointing_device_accumulator_t to check
+ * @return true if there is motion or a button change waiting to be reported
+ */
+bool pointing_device_accumulator_pending(const pointing_device_accumulator_t *accumulator) {
+    return accumulator->x || accumulator->y || accumulator->v || accumulator->h || ((accumulator->buttons | accumulator->buttons_pressed) != accumulator->buttons_reported);
+}
+
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+/**
+ * @brief Weak function allowing the platform to start background sampling
+ *
+ * Called once the pointing device driver has been initialised. Platforms with a sampler start it here; otherwise
+ * pointing_device_sample() must be called by the keyboard, for example from a timer interrupt.
+ *
+ * NOTE : Only available when using POINTING_DEVICE_BACKGROUND_SAMPLING
+ */
+__attribute__((weak)) void pointing_device_sampling_init(void) {}
+
+/**
+ * @brief Samples the pointing device sensor into the background motion accumulator
+ *
+ * Reads the sensor through the pointing device driver and adds the motion to the accumulator drained by pointing device
+ * task, so the sensor can be read at a fixed rate regardless of how long the keyboard loop takes.
+ *
+ * NOTE : Only available when using POINTING_DEVICE_BACKGROUND_SAMPLING
+ */
+void pointing_device_sample(void) {
+    static uint8_t sensor_buttons = 0;
+
+    if (pointing_device_status != POINTING_DEVICE_STATUS_SUCCESS) {
+        return;
+    }
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        endif
+        return;
+    }
+#    endif
+
+    // Drivers keep state across the bus transactions of a read, so CPI changes from the keyboard loop must wait
+    pointing_device_driver_lock();
+    report_mouse_t mouse_report = pointing_device_driver->get_report((report_mouse_t){.buttons = sensor_buttons});
+    pointing_device_driver_unlock();
+    uint32_t timestamp = timer_read32();
+    sensor_buttons     = mouse_report.buttons;
+
+    // May be called from an interrupt, which must not be left with interrupts enabled
+    ATOMIC_BLOCK_RESTORESTATE {
+        pointing_device_accumulator_add(&sample_accumulator, mouse_report, timestamp);
+    }
+}
+#endif
+
+/**
+ * @brief Reads motion from the pointing device sensor
+ *
+ * Passes the mouse report to the pointing device driver, or when using POINTING_DEVICE_BACKGROUND_SAMPLING, fills it with
+ * the motion sampled since the last read. Buttons not reported by the sensor are left as they were. Touch sensors have
+ * their queued samples processed into gestures here.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with the sensor's motion and buttons
+ */
+report_mouse_t pointing_device_read_sensor(report_mouse_t mouse_report) {
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    static uint8_t sensor_buttons = 0;
+    report_mouse_t sampled;
+
+    ATOMIC_BLOCK_FORCEON {
+        sampled = pointing_device_accumulator_drain(&sample_accumulator);
+    }
+    mouse_report.x       = sampled.x;
+    mouse_report.y       = sampled.y;
+    mouse_report.v       = sampled.v;
+    mouse_report.h       = sampled.h;
+    mouse_report.buttons = (mouse_report.buttons & ~sensor_buttons) | sampled.buttons;
+    sensor_buttons       = sampled.buttons;
+#else
+    mouse_report = pointing_device_driver->get_report(mouse_report);
+#endif
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+    // Touch samples are queued by the driver as the sensor is read, and turned into gestures once per report
+    mouse_report = pointing_device_touch_task(mouse_report);
+#endif
+    return mouse_report;
+}
+
 /**
  * @brief Sends processed mouse report to host
  *
@@ -315,8 +513,8 @@ __attribute__((weak)) bool pointing_device_task(void) {
         return false;
     }
 
-    // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
+    // Gather report info, the motion pin is checked by the sampler when sampling in the background
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
 #    if defined(SPLIT_POINTING_ENABLE)
 #        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
 #    endif
@@ -329,21 +527,22 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #endif
 
 #if defined(SPLIT_POINTING_ENABLE)
+        shared_mouse_report = pointing_device_accumulator_drain(&shared_accumulator);
 #    if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
-        local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
+        local_mouse_report         = pointing_device_read_sensor(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_read_sensor(local_mouse_report) : shared_mouse_report;
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+    local_mouse_report = pointing_device_read_sensor(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_BACKGROUND_SAMPLING)
     }
 #endif
 
@@ -356,9 +555,16 @@ __attribute__((weak)) bool pointing_device_task(void) {
         local_mouse_report  = pointing_device_adjust_by_defines_right(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    local_mouse_report  = pointing_device_accel_task(&accel_state, local_mouse_report);
+    shared_mouse_report = pointing_device_accel_task(&shared_accel_state, shared_mouse_report);
+#    endif
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    local_mouse_report = pointing_device_accel_task(&accel_state, local_mouse_report);
+#    endif
 #endif
     local_mouse_report = pointing_device_task_modules(local_mouse_report);
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
@@ -405,6 +611,10 @@ void pointing_device_set_report(report_mouse_t mouse_report) {
  * @return cpi value as uint16_t
  */
 uint16_t pointing_device_get_cpi(void) {
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    // The sampler may be part way through reading the sensor
+    pointing_device_driver_lock_autounlock();
+#endif
 #if defined(SPLIT_POINTING_ENABLE)
     return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_cpi() : shared_cpi;
 #else
@@ -420,6 +630,10 @@ uint16_t pointing_device_get_cpi(void) {
  * @param[in] cpi uint16_t value.
  */
 void pointing_device_set_cpi(uint16_t cpi) {
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    // The sampler may be part way through reading the sensor
+    pointing_device_driver_lock_autounlock();
+#endif
 #if defined(SPLIT_POINTING_ENABLE)
     if (POINTING_DEVICE_THIS_SIDE) {
         pointing_device_driver->set_cpi(cpi);
@@ -429,6 +643,9 @@ void pointing_device_set_cpi(uint16_t cpi) {
 #else
     pointing_device_driver->set_cpi(cpi);
 #endif
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    accel_state.cpi = cpi;
+#endif
 }
 
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -443,12 +660,19 @@ void pointing_device_set_cpi(uint16_t cpi) {
  * @param[in] cpi uint16_t value.
  */
 void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
+#    ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    // The sampler may be part way through reading the sensor
+    pointing_device_driver_lock_autounlock();
+#    endif
     bool local = (is_keyboard_left() == left);
     if (local) {
         pointing_device_driver->set_cpi(cpi);
     } else {
         shared_cpi = cpi;
     }
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    (local ? &accel_state : &shared_accel_state)->cpi = cpi;
+#    endif
 }
 
 /**
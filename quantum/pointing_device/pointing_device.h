@@ -33,6 +33,14 @@ typedef struct {
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    include "pointing_device_accel.h"
+#endif
+
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+#    include "pointing_device_touch.h"
+#endif
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -111,6 +119,17 @@ typedef int32_t hv_clamp_range_t;
 typedef int16_t hv_clamp_range_t;
 #endif
 
+typedef struct {
+    int32_t  x;
+    int32_t  y;
+    int32_t  v;
+    int32_t  h;
+    uint8_t  buttons;
+    uint8_t  buttons_pressed;
+    uint8_t  buttons_reported;
+    uint32_t timestamp;
+} pointing_device_accumulator_t;
+
 #define CONSTRAIN_HID(amt) ((amt) < INT8_MIN ? INT8_MIN : ((amt) > INT8_MAX ? INT8_MAX : (amt)))
 #define CONSTRAIN_HID_XY(amt) ((amt) < MOUSE_REPORT_XY_MIN ? MOUSE_REPORT_XY_MIN : ((amt) > MOUSE_REPORT_XY_MAX ? MOUSE_REPORT_XY_MAX : (amt)))
 
@@ -131,13 +150,28 @@ report_mouse_t pointing_device_task_user(report_mouse_t mouse_report);
 uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, pointing_device_buttons_t button);
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
+report_mouse_t pointing_device_read_sensor(report_mouse_t mouse_report);
+
+void           pointing_device_accumulator_add(pointing_device_accumulator_t *accumulator, report_mouse_t mouse_report, uint32_t timestamp);
+report_mouse_t pointing_device_accumulator_drain(pointing_device_accumulator_t *accumulator);
+bool           pointing_device_accumulator_pending(const pointing_device_accumulator_t *accumulator);
 
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
 uint16_t pointing_device_get_hires_scroll_resolution(void);
 #endif
 
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+#    ifndef POINTING_DEVICE_SAMPLING_INTERVAL_US
+#        define POINTING_DEVICE_SAMPLING_INTERVAL_US 500
+#    endif
+void pointing_device_sampling_init(void);
+void pointing_device_sample(void);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
+void     pointing_device_add_shared_report(report_mouse_t report, uint32_t timestamp);
+uint32_t pointing_device_get_shared_timestamp(void);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
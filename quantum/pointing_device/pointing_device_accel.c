@@ -0,0 +1,229 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+#    include "pointing_device.h"
+#    include "eeconfig.h"
+#    include "progmem.h"
+#    include "timer.h"
+
+// Gains are applied in 1/256ths, and stored in EEPROM in 1/16ths
+#    define GAIN_SHIFT 8
+#    define CONFIG_GAIN_SHIFT 4
+
+// Logistic function 1/(1+e^-z) for z = -8 to 8 in steps of 0.25, scaled by 32768
+#    define LOGISTIC_SHIFT 15
+#    define LOGISTIC_SIZE 65
+static const uint16_t PROGMEM logistic_table[LOGISTIC_SIZE] = {
+    11,    14,    18,    23,    30,    38,    49,    63,    81,    104,   133,   171,   219,   281,   360,   461,   //
+    589,   753,   961,   1223,  1554,  1969,  2486,  3124,  3906,  4851,  5978,  7297,  8813,  10513, 12371, 14347, //
+    16384, 18421, 20397, 22255, 23955, 25471, 26790, 27917, 28862, 29644, 30282, 30799, 31214, 31545, 31807, 32015, //
+    32179, 32307, 32408, 32487, 32549, 32597, 32635, 32664, 32687, 32705, 32719, 32730, 32738, 32745, 32750, 32754, //
+    32757,
+};
+
+static pointing_device_accel_config_t accel_config;
+static uint16_t                       gain_table[POINTING_DEVICE_ACCEL_TABLE_SIZE];
+
+/**
+ * @brief Evaluates the logistic function, with z in 1/16ths
+ *
+ * @return uint16_t logistic function value in 1/32768ths
+ */
+static uint16_t logistic(int32_t z) {
+    // Table entries are 4/16ths apart
+    int32_t position = z + 16 * 8;
+    if (position <= 0) {
+        return pgm_read_word(&logistic_table[0]);
+    }
+    uint16_t index = position / 4;
+    if (index >= LOGISTIC_SIZE - 1) {
+        return pgm_read_word(&logistic_table[LOGISTIC_SIZE - 1]);
+    }
+    uint16_t lower = pgm_read_word(&logistic_table[index]);
+    uint16_t upper = pgm_read_word(&logistic_table[index + 1]);
+    return lower + (uint32_t)(upper - lower) * (position % 4) / 4;
+}
+
+/**
+ * @brief Calculates the gain lookup table for the current curve parameters
+ */
+static void build_gain_table(void) {
+    const int32_t base  = (int32_t)accel_config.base << (GAIN_SHIFT - CONFIG_GAIN_SHIFT);
+    const int32_t limit = (int32_t)MAX(accel_config.limit, accel_config.base) << (GAIN_SHIFT - CONFIG_GAIN_SHIFT);
+
+    for (uint8_t i = 0; i < POINTING_DEVICE_ACCEL_TABLE_SIZE; i++) {
+        const int32_t speed = (int32_t)i * POINTING_DEVICE_ACCEL_TABLE_STEP;
+        int32_t       gain;
+        switch (accel_config.curve) {
+            case POINTING_DEVICE_ACCEL_CURVE_SIGMOID:
+                gain = base + (((limit - base) * logistic((speed - accel_config.offset) * accel_config.growth / 16)) >> LOGISTIC_SHIFT);
+                break;
+            default:
+                gain = base + MAX(speed - accel_config.offset, 0) * accel_config.growth / 16;
+                break;
+        }
+        gain_table[i] = MIN(gain, limit);
+    }
+}
+
+void eeconfig_update_pointing_device_accel_default(void) {
+    accel_config = (pointing_device_accel_config_t){
+        .enable = true,
+        .curve  = POINTING_DEVICE_ACCEL_DEFAULT_CURVE,
+        .offset = POINTING_DEVICE_ACCEL_DEFAULT_OFFSET,
+        .growth = POINTING_DEVICE_ACCEL_DEFAULT_GROWTH,
+        .base   = POINTING_DEVICE_ACCEL_DEFAULT_BASE,
+        .limit  = POINTING_DEVICE_ACCEL_DEFAULT_LIMIT,
+    };
+    eeconfig_update_pointing_device_accel(&accel_config);
+}
+
+/**
+ * @brief Loads the acceleration curve from EEPROM
+ */
+void pointing_device_accel_init(void) {
+    eeconfig_read_pointing_device_accel(&accel_config);
+    if (accel_config.curve >= POINTING_DEVICE_ACCEL_CURVE_COUNT || accel_config.base == 0) {
+        eeconfig_update_pointing_device_accel_default();
+    }
+    build_gain_table();
+}
+
+/**
+ * @brief Gets the current acceleration curve parameters
+ *
+ * @return pointing_device_accel_config_t
+ */
+pointing_device_accel_config_t pointing_device_accel_get_config(void) {
+    return accel_config;
+}
+
+/**
+ * @brief Sets the acceleration curve parameters, without saving them to EEPROM
+ *
+ * @param[in] config pointing_device_accel_config_t
+ */
+void pointing_device_accel_set_config_noeeprom(pointing_device_accel_config_t config) {
+    if (config.curve >= POINTING_DEVICE_ACCEL_CURVE_COUNT) {
+        return;
+    }
+    accel_config = config;
+    build_gain_table();
+}
+
+/**
+ * @brief Sets the acceleration curve parameters, and saves them to EEPROM
+ *
+ * @param[in] config pointing_device_accel_config_t
+ */
+void pointing_device_accel_set_config(pointing_device_accel_config_t config) {
+    pointing_device_accel_set_config_noeeprom(config);
+    pointing_device_accel_save();
+}
+
+/**
+ * @brief Saves the current acceleration curve parameters to EEPROM
+ */
+void pointing_device_accel_save(void) {
+    eeconfig_update_pointing_device_accel(&accel_config);
+}
+
+bool pointing_device_accel_is_enabled(void) {
+    return accel_config.enable;
+}
+
+void pointing_device_accel_enable(bool enable) {
+    accel_config.enable = enable;
+    pointing_device_accel_save();
+}
+
+/**
+ * @brief Looks up the gain for a given speed
+ *
+ * @param[in] speed uint16_t speed in 1/16 counts per millisecond at POINTING_DEVICE_ACCEL_REFERENCE_CPI
+ * @return uint16_t gain in 1/256ths
+ */
+uint16_t pointing_device_accel_gain(uint16_t speed) {
+    uint16_t index = speed / POINTING_DEVICE_ACCEL_TABLE_STEP;
+    if (index >= POINTING_DEVICE_ACCEL_TABLE_SIZE - 1) {
+        return gain_table[POINTING_DEVICE_ACCEL_TABLE_SIZE - 1];
+    }
+    int32_t lower = gain_table[index];
+    int32_t upper = gain_table[index + 1];
+    return lower + (upper - lower) * (speed % POINTING_DEVICE_ACCEL_TABLE_STEP) / POINTING_DEVICE_ACCEL_TABLE_STEP;
+}
+
+static uint16_t isqrt32(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit    = (uint32_t)1 << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+static mouse_xy_report_t accelerate_axis(mouse_xy_report_t value, uint16_t gain, int16_t *remainder) {
+    int32_t scaled = (int32_t)value * gain + *remainder;
+    int32_t result = scaled >> GAIN_SHIFT;
+    *remainder     = scaled - result * (1 << GAIN_SHIFT);
+    return CONSTRAIN_HID_XY(result);
+}
+
+/**
+ * @brief Applies the acceleration curve to a mouse report
+ *
+ * The gain is chosen by the speed of the motion, normalised to POINTING_DEVICE_ACCEL_REFERENCE_CPI using the CPI held in
+ * the device's state. Fractions of a count left over after applying the gain are carried into the next report.
+ *
+ * @param[in] state pointing_device_accel_state_t of the device the report came from
+ * @param[in] mouse_report report_mouse_t to accelerate
+ * @param[in] elapsed time in milliseconds the motion took place over
+ * @return report_mouse_t with accelerated motion
+ */
+report_mouse_t pointing_device_accel_apply(pointing_device_accel_state_t *state, report_mouse_t mouse_report, uint16_t elapsed) {
+    if (!accel_config.enable || (mouse_report.x == 0 && mouse_report.y == 0)) {
+        return mouse_report;
+    }
+
+    // Beyond this the speed is well past the end of any useful curve, and squaring it stays in range
+    const int32_t x = MIN(MAX(mouse_report.x, -2047), 2047);
+    const int32_t y = MIN(MAX(mouse_report.y, -2047), 2047);
+
+    uint32_t speed = isqrt32((uint32_t)(x * x + y * y) << 8); // magnitude in 1/16 counts
+    if (state->cpi) {
+        speed = speed * POINTING_DEVICE_ACCEL_REFERENCE_CPI / state->cpi;
+    }
+    speed /= MIN(MAX(elapsed, 1), POINTING_DEVICE_ACCEL_MAX_INTERVAL_MS);
+
+    const uint16_t gain = pointing_device_accel_gain(MIN(speed, UINT16_MAX));
+    mouse_report.x      = accelerate_axis(mouse_report.x, gain, &state->remainder_x);
+    mouse_report.y      = accelerate_axis(mouse_report.y, gain, &state->remainder_y);
+    return mouse_report;
+}
+
+/**
+ * @brief Applies the acceleration curve to a mouse report, timing the motion since the previous report
+ *
+ * @param[in] state pointing_device_accel_state_t of the device the report came from
+ * @param[in] mouse_report report_mouse_t to accelerate
+ * @return report_mouse_t with accelerated motion
+ */
+report_mouse_t pointing_device_accel_task(pointing_device_accel_state_t *state, report_mouse_t mouse_report) {
+    uint32_t now     = timer_read32();
+    uint32_t elapsed = TIMER_DIFF_32(now, state->timestamp);
+    state->timestamp = now;
+    return pointing_device_accel_apply(state, mouse_report, MIN(elapsed, UINT16_MAX));
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
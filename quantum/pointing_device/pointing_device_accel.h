@@ -0,0 +1,90 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "compiler_support.h"
+#include "util.h"
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_ACCEL_ENABLE
+#    error "POINTING_DEVICE_ACCEL_ENABLE not defined! check config settings"
+#endif
+
+// CPI at which the curve's speeds are specified, motion from devices at other CPIs is scaled to match
+#ifndef POINTING_DEVICE_ACCEL_REFERENCE_CPI
+#    define POINTING_DEVICE_ACCEL_REFERENCE_CPI 1000
+#endif
+// Number of entries in the gain lookup table
+#ifndef POINTING_DEVICE_ACCEL_TABLE_SIZE
+#    define POINTING_DEVICE_ACCEL_TABLE_SIZE 33
+#endif
+// Speed between lookup table entries, in 1/16 counts per millisecond -- faster motion uses the last entry
+#ifndef POINTING_DEVICE_ACCEL_TABLE_STEP
+#    define POINTING_DEVICE_ACCEL_TABLE_STEP 16
+#endif
+// Longest time between reports used to calculate speed, so the first motion after idling is not mistaken as slow
+#ifndef POINTING_DEVICE_ACCEL_MAX_INTERVAL_MS
+#    define POINTING_DEVICE_ACCEL_MAX_INTERVAL_MS 20
+#endif
+
+#ifndef POINTING_DEVICE_ACCEL_DEFAULT_CURVE
+#    define POINTING_DEVICE_ACCEL_DEFAULT_CURVE POINTING_DEVICE_ACCEL_CURVE_SIGMOID
+#endif
+#ifndef POINTING_DEVICE_ACCEL_DEFAULT_OFFSET
+#    define POINTING_DEVICE_ACCEL_DEFAULT_OFFSET 96
+#endif
+#ifndef POINTING_DEVICE_ACCEL_DEFAULT_GROWTH
+#    define POINTING_DEVICE_ACCEL_DEFAULT_GROWTH 8
+#endif
+#ifndef POINTING_DEVICE_ACCEL_DEFAULT_BASE
+#    define POINTING_DEVICE_ACCEL_DEFAULT_BASE 16
+#endif
+#ifndef POINTING_DEVICE_ACCEL_DEFAULT_LIMIT
+#    define POINTING_DEVICE_ACCEL_DEFAULT_LIMIT 48
+#endif
+
+typedef enum {
+    POINTING_DEVICE_ACCEL_CURVE_LINEAR,
+    POINTING_DEVICE_ACCEL_CURVE_SIGMOID,
+    POINTING_DEVICE_ACCEL_CURVE_COUNT,
+} pointing_device_accel_curve_t;
+
+/**
+ * Acceleration curve parameters, as stored in EEPROM.
+ *
+ * Speeds are in 1/16 counts per millisecond at POINTING_DEVICE_ACCEL_REFERENCE_CPI, gains in 1/16ths.
+ */
+typedef struct PACKED pointing_device_accel_config_t {
+    bool    enable : 1;
+    uint8_t curve : 7;
+    uint8_t offset; // linear: speed at which acceleration begins, sigmoid: speed halfway between base and limit
+    uint8_t growth; // linear: gain increase in 1/256ths per count/ms, sigmoid: steepness in 1/16ths per count/ms
+    uint8_t base;   // gain at low speed
+    uint8_t limit;  // gain at high speed
+} pointing_device_accel_config_t;
+
+STATIC_ASSERT(sizeof(pointing_device_accel_config_t) == 5, "Pointing device acceleration EECONFIG out of spec.");
+
+/* per-device state */
+typedef struct {
+    int16_t  remainder_x; // sub-count motion carried into the next report, in 1/256 counts
+    int16_t  remainder_y;
+    uint16_t cpi;
+    uint32_t timestamp;
+} pointing_device_accel_state_t;
+
+void                           pointing_device_accel_init(void);
+void                           eeconfig_update_pointing_device_accel_default(void);
+pointing_device_accel_config_t pointing_device_accel_get_config(void);
+void                           pointing_device_accel_set_config_noeeprom(pointing_device_accel_config_t config);
+void                           pointing_device_accel_set_config(pointing_device_accel_config_t config);
+void                           pointing_device_accel_save(void);
+bool                           pointing_device_accel_is_enabled(void);
+void                           pointing_device_accel_enable(bool enable);
+uint16_t                       pointing_device_accel_gain(uint16_t speed);
+report_mouse_t                 pointing_device_accel_apply(pointing_device_accel_state_t *state, report_mouse_t mouse_report, uint16_t elapsed);
+report_mouse_t                 pointing_device_accel_task(pointing_device_accel_state_t *state, report_mouse_t mouse_report);
@@ -23,6 +23,8 @@
 #    include "debug.h"
 #    include "action_util.h"
 #    include "quantum_keycodes.h"
+#    include "timer.h"
+#    include "util.h"
 
 /* local data structure for tracking auto mouse */
 static auto_mouse_context_t auto_mouse_context = {
@@ -117,6 +119,7 @@ int8_t get_auto_mouse_key_tracker(void) {
 static void auto_mouse_reset(void) {
     memset(&auto_mouse_context.status, 0, sizeof(auto_mouse_context.status));
     memset(&auto_mouse_context.timer, 0, sizeof(auto_mouse_context.timer));
+    memset(&auto_mouse_context.activity, 0, sizeof(auto_mouse_context.activity));
 }
 
 /**
@@ -190,7 +193,7 @@ void set_auto_mouse_key_tracker(int8_t key_tracker) {
  */
 void auto_mouse_toggle(void) {
     auto_mouse_context.status.is_toggled ^= 1;
-    auto_mouse_context.timer.delay = 0;
+    auto_mouse_context.status.is_delayed = false;
 }
 
 /**
@@ -224,23 +227,61 @@ void auto_mouse_layer_off(void) {
     }
 }
 
+/**
+ * @brief Get pointing device activity
+ *
+ * Motion summed over all axes, decayed by half every AUTO_MOUSE_ACTIVITY_HALF_LIFE ms, as of the last update
+ *
+ * @return uint16_t activity in mouse report units
+ */
+uint16_t get_auto_mouse_activity(void) {
+    return auto_mouse_context.activity.level;
+}
+
+/**
+ * @brief Add mouse report motion to the activity accumulator
+ *
+ * Decay is applied in whole half lives since it was last applied, so the cost is the same however long it has been
+ *
+ * @param[in] mouse_report report_mouse_t
+ */
+static void auto_mouse_activity_update(report_mouse_t mouse_report) {
+    uint32_t motion = abs(mouse_report.x) + abs(mouse_report.y) + abs(mouse_report.h) + abs(mouse_report.v);
+
+    if (auto_mouse_context.activity.level) {
+        uint16_t half_lives = timer_elapsed(auto_mouse_context.activity.decay_time) / (AUTO_MOUSE_ACTIVITY_HALF_LIFE);
+        if (half_lives) {
+            auto_mouse_context.activity.level = half_lives < 16 ? auto_mouse_context.activity.level >> half_lives : 0;
+            auto_mouse_context.activity.decay_time += half_lives * (AUTO_MOUSE_ACTIVITY_HALF_LIFE);
+        }
+    }
+    if (!motion) {
+        return;
+    }
+    if (!auto_mouse_context.activity.level) {
+        // a fresh half life starts with the first motion after going idle
+        auto_mouse_context.activity.decay_time = timer_read();
+    }
+    auto_mouse_context.activity.level = MIN((uint32_t)auto_mouse_context.activity.level + motion, UINT16_MAX);
+}
+
 /**
  * @brief Weak function to handel testing if pointing_device is active
  *
  * Will trigger target layer activation(if delay timer has expired) and prevent deactivation when true.
  * May be replaced by bool in report_mouse_t in future
  *
+ * Activity must exceed AUTO_MOUSE_THRESHOLD to turn the target layer on, but only AUTO_MOUSE_HOLD_THRESHOLD to hold it
+ *
  * NOTE: defined weakly to allow for changing and adding conditions for specific hardware/customization
  *
  * @param[in] mouse_report report_mouse_t
  * @return bool of pointing_device activation
  */
 __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
-    auto_mouse_context.total_mouse_movement.x += mouse_report.x;
-    auto_mouse_context.total_mouse_movement.y += mouse_report.y;
-    auto_mouse_context.total_mouse_movement.h += mouse_report.h;
-    auto_mouse_context.total_mouse_movement.v += mouse_report.v;
-    return abs(auto_mouse_context.total_mouse_movement.x) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.y) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.h) > AUTO_MOUSE_THRESHOLD || abs(auto_mouse_context.total_mouse_movement.v) > AUTO_MOUSE_THRESHOLD || mouse_report.buttons;
+    auto_mouse_activity_update(mouse_report);
+    uint16_t threshold = layer_state_is((AUTO_MOUSE_TARGET_LAYER)) ? (AUTO_MOUSE_HOLD_THRESHOLD) : (AUTO_MOUSE_THRESHOLD);
+    return auto_mouse_context.activity.level > threshold || mouse_report.buttons;
 }
 
 /**
@@ -251,23 +292,31 @@ __attribute__((weak)) bool auto_mouse_activation(report_mouse_t mouse_report) {
  * @param[in] mouse_report report_mouse_t
  */
 void pointing_device_task_auto_mouse(report_mouse_t mouse_report) {
-    // skip if disabled, delay timer running, or debounce
-    if (!(AUTO_MOUSE_ENABLED) || timer_elapsed(auto_mouse_context.timer.active) <= auto_mouse_context.config.debounce || timer_elapsed(auto_mouse_context.timer.delay) <= AUTO_MOUSE_DELAY) {
+    // skip if disabled
+    if (!(AUTO_MOUSE_ENABLED)) {
+        return;
+    }
+    // skip while the delay timer is running
+    if (auto_mouse_context.status.is_delayed) {
+        if (timer_elapsed(auto_mouse_context.timer.delay) <= AUTO_MOUSE_DELAY) {
+            return;
+        }
+        auto_mouse_context.status.is_delayed = false;
+    }
+    // skip debounce after activation
+    if (auto_mouse_context.status.is_activated && timer_elapsed(auto_mouse_context.timer.active) <= auto_mouse_context.config.debounce) {
         return;
     }
-    // update activation and reset debounce
+    // update activation, only changing layer state on a transition
     auto_mouse_context.status.is_activated = auto_mouse_activation(mouse_report);
     if (is_auto_mouse_active()) {
-        auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
-        auto_mouse_context.timer.active         = timer_read();
-        auto_mouse_context.timer.delay          = 0;
+        auto_mouse_context.timer.active = timer_read();
         if (!layer_state_is((AUTO_MOUSE_TARGET_LAYER))) {
             layer_on((AUTO_MOUSE_TARGET_LAYER));
         }
     } else if (layer_state_is((AUTO_MOUSE_TARGET_LAYER)) && timer_elapsed(auto_mouse_context.timer.active) > auto_mouse_context.config.timeout) {
         layer_off((AUTO_MOUSE_TARGET_LAYER));
-        auto_mouse_context.timer.active         = 0;
-        auto_mouse_context.total_mouse_movement = (total_mouse_movement_t){.x = 0, .y = 0, .h = 0, .v = 0};
+        memset(&auto_mouse_context.activity, 0, sizeof(auto_mouse_context.activity));
     }
 }
 
@@ -284,7 +333,7 @@ void auto_mouse_keyevent(bool pressed) {
     } else {
         auto_mouse_context.status.mouse_key_tracker--;
     }
-    auto_mouse_context.timer.delay = 0;
+    auto_mouse_context.status.is_delayed = false;
 }
 
 /**
@@ -304,7 +353,8 @@ void auto_mouse_reset_trigger(bool pressed) {
         };
         auto_mouse_reset();
     }
-    auto_mouse_context.timer.delay = timer_read();
+    auto_mouse_context.timer.delay       = timer_read();
+    auto_mouse_context.status.is_delayed = true;
 }
 
 /**
@@ -24,6 +24,7 @@
 #include "report.h"
 #include "action_layer.h"
 #include "action_tapping.h"
+#include "compiler_support.h"
 
 /* check settings and set defaults */
 #ifndef POINTING_DEVICE_AUTO_MOUSE_ENABLE
@@ -45,14 +46,19 @@
 #ifndef AUTO_MOUSE_THRESHOLD
 #    define AUTO_MOUSE_THRESHOLD 10
 #endif
+// Activity needed to hold the target layer once on, below AUTO_MOUSE_THRESHOLD so that slowing down does not drop it
+#ifndef AUTO_MOUSE_HOLD_THRESHOLD
+#    define AUTO_MOUSE_HOLD_THRESHOLD (AUTO_MOUSE_THRESHOLD / 2)
+#endif
+// Time for accumulated activity to halve, so that sensor jitter spread over time never adds up to an activation
+#ifndef AUTO_MOUSE_ACTIVITY_HALF_LIFE
+#    define AUTO_MOUSE_ACTIVITY_HALF_LIFE 50
+#endif
+
+STATIC_ASSERT(AUTO_MOUSE_HOLD_THRESHOLD <= AUTO_MOUSE_THRESHOLD, "AUTO_MOUSE_HOLD_THRESHOLD must not be greater than AUTO_MOUSE_THRESHOLD");
+STATIC_ASSERT(AUTO_MOUSE_ACTIVITY_HALF_LIFE > 0, "AUTO_MOUSE_ACTIVITY_HALF_LIFE must be greater than 0");
 
 /* data structure */
-typedef struct {
-    mouse_xy_report_t x;
-    mouse_xy_report_t y;
-    int8_t            v;
-    int8_t            h;
-} total_mouse_movement_t;
 typedef struct {
     struct {
         bool     is_enabled;
@@ -67,9 +73,13 @@ typedef struct {
     struct {
         bool   is_activated;
         bool   is_toggled;
+        bool   is_delayed;
         int8_t mouse_key_tracker;
     } status;
-    total_mouse_movement_t total_mouse_movement;
+    struct {
+        uint16_t level;      // motion summed over all axes, halving every AUTO_MOUSE_ACTIVITY_HALF_LIFE
+        uint16_t decay_time; // time level was last decayed from
+    } activity;
 } auto_mouse_context_t;
 
 /* ----------Set up and control------------------------------------------------------------------------------ */
@@ -86,6 +96,7 @@ int8_t        get_auto_mouse_key_tracker(void);                         // get k
 void          auto_mouse_layer_off(void);                               // disable target layer if appropriate (DO NOT USE in layer_state_set stack!!)
 layer_state_t remove_auto_mouse_layer(layer_state_t state, bool force); // remove auto mouse target layer from state if appropriate (can be forced)
 bool          is_auto_mouse_active(void);                               // check if target layer is active
+uint16_t      get_auto_mouse_activity(void);                            // get decayed pointing device activity
 /* ----------For custom pointing device activation----------------------------------------------------------- */
 bool auto_mouse_activation(report_mouse_t mouse_report); // handles pointing device trigger conditions for target layer activation (overwritable)
 
@@ -0,0 +1,243 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_TOUCH_ENABLE
+
+#    include <stdlib.h>
+#    include <string.h>
+#    include "pointing_device.h"
+#    include "pointing_device_gestures.h"
+#    include "atomic_util.h"
+#    include "timer.h"
+#    include "util.h"
+
+static struct {
+    touch_event_t events[POINTING_DEVICE_TOUCH_QUEUE_SIZE];
+    uint8_t       tail;
+    uint8_t       count;
+} queue;
+
+/* State of the contact currently on the sensor */
+static struct {
+    uint16_t x;
+    uint16_t y;
+    uint8_t  fingers;
+    uint8_t  max_fingers; // most fingers seen since touchdown, deciding which button a tap presses
+    bool     claimed;     // set once any sample of the contact was claimed by another gesture
+    uint16_t touch_time;
+    uint16_t travel;
+    int16_t  scroll_h; // motion not yet reported as scroll
+    int16_t  scroll_v;
+} contact;
+
+static pointing_device_accumulator_t accumulator;
+static uint8_t                       tap_buttons;
+
+#    ifdef POINTING_DEVICE_TOUCH_TAP_ENABLE
+static bool tap_enable = true;
+
+void pointing_device_touch_enable_tap(bool enable) {
+    tap_enable = enable;
+}
+#    endif
+
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+static bool cursor_glide_enable = true;
+
+static cursor_glide_context_t glide = {.config = {
+                                           .coef       = 102, /* Good default friction coef */
+                                           .interval   = 10,  /* 100sps */
+                                           .trigger_px = 10,  /* Default threshold in case of hover, set to 0 if you'd like */
+                                       }};
+
+void pointing_device_touch_enable_cursor_glide(bool enable) {
+    cursor_glide_enable = enable;
+}
+
+void pointing_device_touch_configure_cursor_glide(uint16_t trigger_px) {
+    glide.config.trigger_px = trigger_px;
+}
+#    endif
+
+static inline int16_t scroll_take(int16_t *remainder, int16_t distance) {
+    int32_t total = (int32_t)*remainder + distance;
+    *remainder    = total % POINTING_DEVICE_TOUCH_SCROLL_DIVISOR;
+    return total / POINTING_DEVICE_TOUCH_SCROLL_DIVISOR;
+}
+
+static void touch_down(touch_event_t event) {
+    contact.x           = event.x;
+    contact.y           = event.y;
+    contact.fingers     = event.fingers;
+    contact.max_fingers = event.fingers;
+    contact.claimed     = event.claimed;
+    contact.touch_time  = event.timestamp;
+    contact.travel      = 0;
+    contact.scroll_h    = 0;
+    contact.scroll_v    = 0;
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+    cursor_glide_update(&glide, 0, 0, event.fingers);
+#    endif
+}
+
+static void touch_move(touch_event_t event) {
+    // Differences are taken in 16 bits so that positions are free to wrap
+    int16_t dx = (int16_t)(event.x - contact.x);
+    int16_t dy = (int16_t)(event.y - contact.y);
+    contact.x  = event.x;
+    contact.y  = event.y;
+
+    uint16_t distance = abs(dx) + abs(dy);
+    contact.travel    = distance > UINT16_MAX - contact.travel ? UINT16_MAX : contact.travel + distance;
+    contact.claimed |= event.claimed;
+
+    if (event.fingers != contact.fingers) {
+        // Fingers arriving or leaving move the reported position, so it is re-baselined rather than treated as motion
+        contact.fingers     = event.fingers;
+        contact.max_fingers = MAX(contact.max_fingers, event.fingers);
+        contact.scroll_h    = 0;
+        contact.scroll_v    = 0;
+        dx                  = 0;
+        dy                  = 0;
+    } else if (event.claimed) {
+        dx = 0;
+        dy = 0;
+    } else if (event.fingers == 1) {
+        accumulator.x += dx;
+        accumulator.y += dy;
+    } else {
+        accumulator.h += scroll_take(&contact.scroll_h, dx);
+        accumulator.v += scroll_take(&contact.scroll_v, dy);
+        dx = 0;
+        dy = 0;
+    }
+
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+    cursor_glide_update(&glide, CONSTRAIN_HID_XY(dx), CONSTRAIN_HID_XY(dy), event.fingers);
+#    endif
+}
+
+static void touch_up(touch_event_t event) {
+    contact.claimed |= event.claimed;
+
+#    ifdef POINTING_DEVICE_TOUCH_TAP_ENABLE
+    if (tap_enable && !contact.claimed && contact.travel <= POINTING_DEVICE_TOUCH_TAP_DISTANCE && TIMER_DIFF_16(event.timestamp, contact.touch_time) < POINTING_DEVICE_TOUCH_TAPPING_TERM) {
+        pointing_device_buttons_t button = POINTING_DEVICE_BUTTON1 + MIN(contact.max_fingers, 3) - 1;
+        accumulator.buttons_pressed      = pointing_device_handle_buttons(accumulator.buttons_pressed, true, button);
+    }
+#    endif
+
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+    if (cursor_glide_enable && !contact.claimed && contact.fingers == 1) {
+        cursor_glide_t glide_report = cursor_glide_start(&glide);
+        if (glide_report.valid) {
+            accumulator.x += glide_report.dx;
+            accumulator.y += glide_report.dy;
+        }
+    }
+#    endif
+
+    contact.fingers = 0;
+}
+
+/**
+ * @brief Runs a single sample through the gesture engine
+ *
+ * @param[in] event touch_event_t to process
+ */
+static void touch_process(touch_event_t event) {
+    if (event.fingers == 0) {
+        if (contact.fingers) {
+            touch_up(event);
+        }
+    } else if (contact.fingers == 0) {
+        touch_down(event);
+    } else {
+        touch_move(event);
+    }
+}
+
+/**
+ * @brief Queues a sample from a touch sensor for the gesture engine
+ *
+ * Called by the driver's get_report, which may run in the background sampler while pointing_device_touch_task runs in
+ * the keyboard loop. If the queue is full the oldest sample is processed straight away to make room, so none are lost.
+ *
+ * @param[in] event touch_event_t sampled from the sensor
+ */
+void pointing_device_touch_push(touch_event_t event) {
+    // Pushed from the sampling interrupt on platforms without threads, so the interrupt state is restored
+    ATOMIC_BLOCK_RESTORESTATE {
+        if (queue.count == POINTING_DEVICE_TOUCH_QUEUE_SIZE) {
+            touch_process(queue.events[queue.tail]);
+            queue.tail = (queue.tail + 1) % POINTING_DEVICE_TOUCH_QUEUE_SIZE;
+            queue.count--;
+        }
+        queue.events[(queue.tail + queue.count) % POINTING_DEVICE_TOUCH_QUEUE_SIZE] = event;
+        queue.count++;
+    }
+}
+
+/**
+ * @brief Processes queued touch samples into a mouse report
+ *
+ * One finger moves the cursor, two or more scroll, and short touches that barely move tap a button chosen by the number
+ * of fingers. Tapped buttons are released again on the following call. Run by pointing_device_read_sensor each time the
+ * sensor's report is read, so with POINTING_DEVICE_BACKGROUND_SAMPLING every sample taken since the last report is
+ * processed here.
+ *
+ * @param[in] mouse_report report_mouse_t from the sensor driver, with any gestures it handles itself
+ * @return report_mouse_t with touch gestures added
+ */
+report_mouse_t pointing_device_touch_task(report_mouse_t mouse_report) {
+    report_mouse_t touch_report;
+
+    mouse_report.buttons &= ~tap_buttons;
+
+    // The queue, contact and accumulator are shared with pointing_device_touch_push
+    ATOMIC_BLOCK_FORCEON {
+        while (queue.count) {
+            touch_process(queue.events[queue.tail]);
+            queue.tail = (queue.tail + 1) % POINTING_DEVICE_TOUCH_QUEUE_SIZE;
+            queue.count--;
+        }
+
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+        if (cursor_glide_enable) {
+            cursor_glide_t glide_report = cursor_glide_check(&glide);
+            if (glide_report.valid) {
+                accumulator.x += glide_report.dx;
+                accumulator.y += glide_report.dy;
+            }
+        }
+#    endif
+
+        accumulator.x += mouse_report.x;
+        accumulator.y += mouse_report.y;
+        accumulator.h += mouse_report.h;
+        accumulator.v += mouse_report.v;
+
+        touch_report = pointing_device_accumulator_drain(&accumulator);
+    }
+
+    tap_buttons = touch_report.buttons;
+    touch_report.buttons |= mouse_report.buttons;
+    return touch_report;
+}
+
+/**
+ * @brief Discards queued samples and any contact in progress
+ */
+void pointing_device_touch_reset(void) {
+    ATOMIC_BLOCK_FORCEON {
+        memset(&queue, 0, sizeof(queue));
+        memset(&contact, 0, sizeof(contact));
+        memset(&accumulator, 0, sizeof(accumulator));
+        tap_buttons = 0;
+#    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+        memset(&glide.status, 0, sizeof(glide.status));
+#    endif
+    }
+}
+
+#endif // POINTING_DEVICE_TOUCH_ENABLE
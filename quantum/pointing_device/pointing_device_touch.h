@@ -0,0 +1,72 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "compiler_support.h"
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_TOUCH_ENABLE
+#    error "POINTING_DEVICE_TOUCH_ENABLE not defined! check config settings"
+#endif
+
+// Cirque Pinnacle tap options predate the shared gesture engine
+#if defined(CIRQUE_PINNACLE_TAP_ENABLE) && !defined(POINTING_DEVICE_TOUCH_TAP_ENABLE)
+#    define POINTING_DEVICE_TOUCH_TAP_ENABLE
+#endif
+#if defined(CIRQUE_PINNACLE_TAPPING_TERM) && !defined(POINTING_DEVICE_TOUCH_TAPPING_TERM)
+#    define POINTING_DEVICE_TOUCH_TAPPING_TERM CIRQUE_PINNACLE_TAPPING_TERM
+#endif
+#ifdef CIRQUE_PINNACLE_TOUCH_DEBOUNCE
+#    error "CIRQUE_PINNACLE_TOUCH_DEBOUNCE has been removed, taps are now timed from touchdown against POINTING_DEVICE_TOUCH_TAPPING_TERM"
+#endif
+
+// Number of samples that can be queued between reports -- the oldest is processed early when full
+#ifndef POINTING_DEVICE_TOUCH_QUEUE_SIZE
+#    define POINTING_DEVICE_TOUCH_QUEUE_SIZE 8
+#endif
+// Distance fingers move for each unit of two-finger scroll
+#ifndef POINTING_DEVICE_TOUCH_SCROLL_DIVISOR
+#    define POINTING_DEVICE_TOUCH_SCROLL_DIVISOR 1
+#endif
+#ifdef POINTING_DEVICE_TOUCH_TAP_ENABLE
+#    ifndef POINTING_DEVICE_TOUCH_TAPPING_TERM
+#        include "action.h"
+#        include "action_tapping.h"
+#        define POINTING_DEVICE_TOUCH_TAPPING_TERM GET_TAPPING_TERM(QK_MOUSE_BUTTON_1, &(keyrecord_t){})
+#    endif
+// Furthest a contact can travel, summed over both axes, and still count as a tap
+#    ifndef POINTING_DEVICE_TOUCH_TAP_DISTANCE
+#        define POINTING_DEVICE_TOUCH_TAP_DISTANCE 64
+#    endif
+#endif
+
+STATIC_ASSERT(POINTING_DEVICE_TOUCH_QUEUE_SIZE > 0 && POINTING_DEVICE_TOUCH_QUEUE_SIZE <= UINT8_MAX, "POINTING_DEVICE_TOUCH_QUEUE_SIZE must be between 1 and 255");
+STATIC_ASSERT(POINTING_DEVICE_TOUCH_SCROLL_DIVISOR > 0, "POINTING_DEVICE_TOUCH_SCROLL_DIVISOR must be greater than 0");
+
+/**
+ * A single sample of the contacts on a touch sensor.
+ *
+ * Positions are absolute and may wrap, so sensors reporting relative motion can feed a running sum.
+ */
+typedef struct {
+    uint16_t timestamp; // time the sample was taken, from timer_read()
+    uint16_t x;
+    uint16_t y;
+    uint8_t  fingers; // number of contacts, 0 once lifted
+    bool     claimed; // contact has been used by another gesture, so produces neither motion nor a tap
+} touch_event_t;
+
+void           pointing_device_touch_push(touch_event_t event);
+report_mouse_t pointing_device_touch_task(report_mouse_t mouse_report);
+void           pointing_device_touch_reset(void);
+#ifdef POINTING_DEVICE_TOUCH_TAP_ENABLE
+void pointing_device_touch_enable_tap(bool enable);
+#endif
+#ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
+void pointing_device_touch_enable_cursor_glide(bool enable);
+void pointing_device_touch_configure_cursor_glide(uint16_t trigger_px);
+#endif
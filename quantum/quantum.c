@@ -93,6 +93,10 @@
 #    include "process_oneshot.h"
 #endif
 
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_CACHE_ENABLE)
+#    include "wear_leveling.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -235,6 +239,10 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_WRITE_CACHE_ENABLE)
+    // Make sure deferred EEPROM writes hit the backing store before resetting
+    wear_leveling_flush();
+#endif
 }
 
 void reset_keyboard(void) {
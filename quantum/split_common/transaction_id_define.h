@@ -82,7 +82,7 @@ enum serial_transaction_id {
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
-    GET_POINTING_CHECKSUM,
+    GET_POINTING_PENDING,
     GET_POINTING_DATA,
     PUT_POINTING_CPI,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
@@ -100,6 +100,9 @@ enum serial_transaction_id {
 #endif // SPLIT_ACTIVITY_ENABLE
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+#    ifdef SPLIT_RPC_MAILBOX_ENABLE
+    EXCHANGE_RPC_MAILBOX,
+#    endif // SPLIT_RPC_MAILBOX_ENABLE
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
     EXECUTE_RPC,
@@ -81,6 +81,9 @@
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
+#define trans_bidirectional_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
@@ -92,6 +95,9 @@
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+#    ifdef SPLIT_RPC_MAILBOX_ENABLE
+void slave_rpc_mailbox_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+#    endif // SPLIT_RPC_MAILBOX_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 ////////////////////////////////////////////////////
@@ -718,10 +724,25 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint32_t last_update     = 0;
     static uint32_t last_cpi_update = 0;
     static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
+    static uint8_t  last_sequence   = 0;
+    bool            pending         = false;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    bool            okay = transport_read(GET_POINTING_PENDING, &pending, sizeof(pending));
+    if (okay && (pending || timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS)) {
+        // Acknowledge the last motion received, so the slave knows whether to drain new motion or resend the previous
+        split_pointing_motion_t motion;
+        okay = transport_execute_transaction(GET_POINTING_DATA, &last_sequence, sizeof(last_sequence), &motion, sizeof(motion));
+        if (okay) {
+            okay = motion.checksum == crc8(&motion.payload, sizeof(motion.payload));
+        }
+        if (okay) {
+            if (motion.payload.sequence != last_sequence) {
+                last_sequence = motion.payload.sequence;
+                pointing_device_add_shared_report(motion.payload.report, motion.payload.timestamp);
+            }
+            last_update = timer_read32();
+        }
+    }
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -735,6 +756,9 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
 
 extern const pointing_device_driver_t *pointing_device_driver;
 
+// Motion sampled on the slave side, only accessed while holding the split shared memory lock
+static pointing_device_accumulator_t slave_pointing_accumulator = {0};
+
 static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
     if (!is_keyboard_left()) {
@@ -753,29 +777,49 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     last_exec = timer_read32();
 #    endif
 
+#    ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    // The sampler may be part way through reading the sensor
+    pointing_device_driver_lock();
+#    endif
     uint16_t temp_cpi = !pointing_device_driver->get_cpi ? 0 : pointing_device_driver->get_cpi(); // check for NULL
 
     split_shared_memory_lock();
-    split_slave_pointing_sync_t pointing;
-    memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
+    uint16_t cpi = split_shmem->pointing.cpi;
     split_shared_memory_unlock();
 
-    if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver->set_cpi) {
-        pointing_device_driver->set_cpi(pointing.cpi);
+    if (cpi && cpi != temp_cpi && pointing_device_driver->set_cpi) {
+        pointing_device_driver->set_cpi(cpi);
     }
+#    ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+    pointing_device_driver_unlock();
+#    endif
 
-    pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
-    // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    // Read the sensor at this side's own rate -- motion is accumulated until the master drains it
+    report_mouse_t report = pointing_device_read_sensor((report_mouse_t){0});
 
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    pointing_device_accumulator_add(&slave_pointing_accumulator, report, sync_timer_read32());
+    split_shmem->pointing.pending = pointing_device_accumulator_pending(&slave_pointing_accumulator);
     split_shared_memory_unlock();
 }
 
+static void slave_pointing_data_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_pointing_motion_t *motion = &split_shmem->pointing.motion;
+
+    // Only drain new motion once the master has acknowledged the previous motion, otherwise send it again
+    if (split_shmem->pointing.sequence_ack == motion->payload.sequence) {
+        motion->payload.sequence++;
+        motion->payload.timestamp = slave_pointing_accumulator.timestamp;
+        motion->payload.report    = pointing_device_accumulator_drain(&slave_pointing_accumulator);
+        motion->checksum          = crc8(&motion->payload, sizeof(motion->payload));
+
+        split_shmem->pointing.pending = pointing_device_accumulator_pending(&slave_pointing_accumulator);
+    }
+}
+
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_PENDING] = trans_target2initiator_initializer(pointing.pending), [GET_POINTING_DATA] = trans_bidirectional_initializer_cb(pointing.sequence_ack, pointing.motion, slave_pointing_data_callback), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -914,6 +958,195 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// RPC mailbox
+
+#if (defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)) && defined(SPLIT_RPC_MAILBOX_ENABLE)
+
+// Transaction buffer sizes are tracked as uint8_t, so the whole mailbox needs to fit
+STATIC_ASSERT(sizeof(rpc_mailbox_m2s_t) <= UINT8_MAX, "RPC_MAILBOX_M2S_BUFFER_SIZE too large");
+STATIC_ASSERT(sizeof(rpc_mailbox_s2m_t) <= UINT8_MAX, "RPC_MAILBOX_S2M_BUFFER_SIZE too large");
+
+#    define rpc_mailbox_checksum(mailbox) crc8(&(mailbox)->payload, offsetof(__typeof__((mailbox)->payload), data) + (mailbox)->payload.length)
+
+// Master-side staging area. Requests are appended in-place in their wire format, so a flush is a single copy into the
+// shared memory. Once a flush has been attempted the mailbox is sealed until the slave's response has been received,
+// so that a retried exchange never carries records the slave has not yet seen under the same sequence number.
+static rpc_mailbox_m2s_t         rpc_mailbox_outbox;
+static rpc_completion_callback_t rpc_mailbox_callbacks[RPC_MAILBOX_QUEUE_SIZE];
+static uint8_t                   rpc_mailbox_s2m_reserved = 0;
+static uint8_t                   rpc_mailbox_sequence     = 0;
+static uint8_t                   rpc_mailbox_attempts     = 0;
+static bool                      rpc_mailbox_sealed       = false;
+
+static void rpc_mailbox_reset(void) {
+    rpc_mailbox_outbox.payload.count  = 0;
+    rpc_mailbox_outbox.payload.length = 0;
+    rpc_mailbox_s2m_reserved          = 0;
+    rpc_mailbox_attempts              = 0;
+    rpc_mailbox_sealed                = false;
+}
+
+static void rpc_mailbox_abort(void) {
+    const uint8_t *record = rpc_mailbox_outbox.payload.data;
+    for (uint8_t i = 0; i < rpc_mailbox_outbox.payload.count; ++i) {
+        if (rpc_mailbox_callbacks[i]) {
+            rpc_mailbox_callbacks[i]((int8_t)record[0], false, 0, NULL);
+        }
+        record += RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + record[1];
+    }
+    rpc_mailbox_reset();
+}
+
+static void rpc_mailbox_complete(const rpc_mailbox_s2m_t *inbox) {
+    const uint8_t *request = rpc_mailbox_outbox.payload.data;
+    const uint8_t *result  = inbox->payload.data;
+    const uint8_t *end     = inbox->payload.data + inbox->payload.length;
+    for (uint8_t i = 0; i < rpc_mailbox_outbox.payload.count; ++i) {
+        // Anything the slave could not fit or did not execute is reported as a failure
+        bool success = (i < inbox->payload.count) && (result + RPC_MAILBOX_S2M_RECORD_HEADER_SIZE <= end) && (result + RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + result[1] <= end) && (result[0] == request[0]);
+        if (rpc_mailbox_callbacks[i]) {
+            rpc_mailbox_callbacks[i]((int8_t)request[0], success, success ? result[1] : 0, success ? &result[RPC_MAILBOX_S2M_RECORD_HEADER_SIZE] : NULL);
+        }
+        if (success) {
+            result += RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + result[1];
+        }
+        request += RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + request[1];
+    }
+    rpc_mailbox_reset();
+}
+
+bool transaction_rpc_queue(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, rpc_completion_callback_t callback) {
+    // Prevent transaction attempts while transport is disconnected
+    if (!is_transport_connected()) {
+        return false;
+    }
+    // Prevent invoking RPC on QMK core sync data
+    if (transaction_id <= GET_RPC_RESP_DATA) return false;
+    // Don't append to a mailbox that is already in flight
+    if (rpc_mailbox_sealed) return false;
+    // Prevent sizing issues
+    if (rpc_mailbox_outbox.payload.count >= RPC_MAILBOX_QUEUE_SIZE) return false;
+    if (initiator2target_buffer_size > RPC_M2S_BUFFER_SIZE) return false;
+    if (target2initiator_buffer_size > RPC_S2M_BUFFER_SIZE) return false;
+    if ((uint16_t)rpc_mailbox_outbox.payload.length + RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + initiator2target_buffer_size > RPC_MAILBOX_M2S_BUFFER_SIZE) return false;
+    if ((uint16_t)rpc_mailbox_s2m_reserved + RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + target2initiator_buffer_size > RPC_MAILBOX_S2M_BUFFER_SIZE) return false;
+
+    uint8_t *record = &rpc_mailbox_outbox.payload.data[rpc_mailbox_outbox.payload.length];
+    record[0]       = (uint8_t)transaction_id;
+    record[1]       = initiator2target_buffer_size;
+    record[2]       = target2initiator_buffer_size;
+    if (initiator2target_buffer_size > 0) {
+        memcpy(&record[RPC_MAILBOX_M2S_RECORD_HEADER_SIZE], initiator2target_buffer, initiator2target_buffer_size);
+    }
+
+    rpc_mailbox_callbacks[rpc_mailbox_outbox.payload.count++] = callback;
+    rpc_mailbox_outbox.payload.length += RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + initiator2target_buffer_size;
+    rpc_mailbox_s2m_reserved += RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + target2initiator_buffer_size;
+    return true;
+}
+
+uint8_t transaction_rpc_queue_pending(void) {
+    return rpc_mailbox_outbox.payload.count;
+}
+
+static bool rpc_mailbox_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    if (rpc_mailbox_outbox.payload.count == 0) {
+        return true;
+    }
+
+    if (!rpc_mailbox_sealed) {
+        // Sequence number zero is reserved for "nothing received yet" on the slave side
+        if (++rpc_mailbox_sequence == 0) {
+            rpc_mailbox_sequence = 1;
+        }
+        rpc_mailbox_outbox.payload.sequence = rpc_mailbox_sequence;
+        rpc_mailbox_outbox.checksum         = rpc_mailbox_checksum(&rpc_mailbox_outbox);
+        rpc_mailbox_sealed                  = true;
+    }
+
+    rpc_mailbox_s2m_t inbox;
+    if (!transport_execute_transaction(EXCHANGE_RPC_MAILBOX, &rpc_mailbox_outbox, sizeof(rpc_mailbox_outbox), &inbox, sizeof(inbox))) {
+        if (!is_transport_connected()) {
+            // The slave may never answer -- notify everyone waiting rather than holding the mailbox indefinitely
+            rpc_mailbox_abort();
+        }
+        return false;
+    }
+
+    if (inbox.payload.length <= RPC_MAILBOX_S2M_BUFFER_SIZE && inbox.checksum == rpc_mailbox_checksum(&inbox) && inbox.payload.sequence == rpc_mailbox_outbox.payload.sequence) {
+        rpc_mailbox_complete(&inbox);
+    } else if (++rpc_mailbox_attempts >= RPC_MAILBOX_MAX_ATTEMPTS) {
+        // The slave keeps rejecting this mailbox, so give up on it rather than retrying forever
+        rpc_mailbox_abort();
+    }
+    // The link itself is fine, so a rejected or stale reply only means there is no response this cycle and must not
+    // hold up the rest of the transactions
+    return true;
+}
+
+void slave_rpc_mailbox_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static uint8_t           last_checksum = 0;
+    const rpc_mailbox_m2s_t *outbox        = &split_shmem->rpc_mailbox_m2s;
+    rpc_mailbox_s2m_t       *inbox         = &split_shmem->rpc_mailbox_s2m;
+
+    if (outbox->payload.length > RPC_MAILBOX_M2S_BUFFER_SIZE || outbox->checksum != rpc_mailbox_checksum(outbox)) {
+        return;
+    }
+
+    // A retried exchange of a mailbox that has already been executed only needs the cached response sent back
+    if (outbox->payload.sequence == inbox->payload.sequence && outbox->checksum == last_checksum) {
+        return;
+    }
+
+    const uint8_t *record = outbox->payload.data;
+    const uint8_t *end    = outbox->payload.data + outbox->payload.length;
+    uint8_t       *result = inbox->payload.data;
+    uint8_t        count  = 0;
+
+    for (; count < outbox->payload.count && record + RPC_MAILBOX_M2S_RECORD_HEADER_SIZE <= end; ++count) {
+        int8_t  transaction_id = (int8_t)record[0];
+        uint8_t m2s_length     = record[1];
+        uint8_t s2m_length     = record[2];
+        if (record + RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + m2s_length > end || result + RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + s2m_length > inbox->payload.data + RPC_MAILBOX_S2M_BUFFER_SIZE) {
+            break;
+        }
+
+        result[0] = (uint8_t)transaction_id;
+        result[1] = s2m_length;
+        memset(&result[RPC_MAILBOX_S2M_RECORD_HEADER_SIZE], 0, s2m_length);
+        if (transaction_id > GET_RPC_RESP_DATA && transaction_id < NUM_TOTAL_TRANSACTIONS) {
+            split_transaction_desc_t *trans = &split_transaction_table[transaction_id];
+            if (trans->slave_callback) {
+                trans->slave_callback(m2s_length, &record[RPC_MAILBOX_M2S_RECORD_HEADER_SIZE], s2m_length, &result[RPC_MAILBOX_S2M_RECORD_HEADER_SIZE]);
+            }
+        }
+
+        record += RPC_MAILBOX_M2S_RECORD_HEADER_SIZE + m2s_length;
+        result += RPC_MAILBOX_S2M_RECORD_HEADER_SIZE + s2m_length;
+    }
+
+    inbox->payload.sequence = outbox->payload.sequence;
+    inbox->payload.count    = count;
+    inbox->payload.length   = (uint8_t)(result - inbox->payload.data);
+    inbox->checksum         = rpc_mailbox_checksum(inbox);
+    last_checksum           = outbox->checksum;
+}
+
+// clang-format off
+#    define TRANSACTIONS_RPC_MAILBOX_MASTER() TRANSACTION_HANDLER_MASTER(rpc_mailbox)
+#    define TRANSACTIONS_RPC_MAILBOX_SLAVE()
+#    define TRANSACTIONS_RPC_MAILBOX_REGISTRATIONS [EXCHANGE_RPC_MAILBOX] = trans_bidirectional_initializer_cb(rpc_mailbox_m2s, rpc_mailbox_s2m, slave_rpc_mailbox_callback),
+// clang-format on
+
+#else // (defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)) && defined(SPLIT_RPC_MAILBOX_ENABLE)
+
+#    define TRANSACTIONS_RPC_MAILBOX_MASTER()
+#    define TRANSACTIONS_RPC_MAILBOX_SLAVE()
+#    define TRANSACTIONS_RPC_MAILBOX_REGISTRATIONS
+
+#endif // (defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)) && defined(SPLIT_RPC_MAILBOX_ENABLE)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1177,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_RPC_MAILBOX_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -974,6 +1208,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_RPC_MAILBOX_MASTER();
     return true;
 }
 
@@ -997,6 +1232,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_RPC_MAILBOX_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -51,3 +51,13 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#ifdef SPLIT_RPC_MAILBOX_ENABLE
+typedef void (*rpc_completion_callback_t)(int8_t transaction_id, bool success, uint8_t target2initiator_buffer_size, const void *target2initiator_buffer);
+
+// returns false if the mailbox is full or the request is invalid, in which case the callback will not be invoked
+bool    transaction_rpc_queue(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, rpc_completion_callback_t callback);
+uint8_t transaction_rpc_queue_pending(void);
+
+#    define transaction_rpc_queue_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_queue(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
+#endif // SPLIT_RPC_MAILBOX_ENABLE
@@ -31,6 +31,24 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifdef SPLIT_RPC_MAILBOX_ENABLE
+#    ifndef RPC_MAILBOX_M2S_BUFFER_SIZE
+#        define RPC_MAILBOX_M2S_BUFFER_SIZE 64
+#    endif // RPC_MAILBOX_M2S_BUFFER_SIZE
+
+#    ifndef RPC_MAILBOX_S2M_BUFFER_SIZE
+#        define RPC_MAILBOX_S2M_BUFFER_SIZE 64
+#    endif // RPC_MAILBOX_S2M_BUFFER_SIZE
+
+#    ifndef RPC_MAILBOX_QUEUE_SIZE
+#        define RPC_MAILBOX_QUEUE_SIZE 8
+#    endif // RPC_MAILBOX_QUEUE_SIZE
+
+#    ifndef RPC_MAILBOX_MAX_ATTEMPTS
+#        define RPC_MAILBOX_MAX_ATTEMPTS 10
+#    endif // RPC_MAILBOX_MAX_ATTEMPTS
+#endif // SPLIT_RPC_MAILBOX_ENABLE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -108,10 +126,20 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+typedef struct _split_pointing_motion_t {
+    uint8_t checksum;
+    struct {
+        uint8_t        sequence;
+        uint32_t       timestamp;
+        report_mouse_t report;
+    } payload;
+} split_pointing_motion_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    bool                    pending;
+    uint8_t                 sequence_ack;
+    split_pointing_motion_t motion;
+    uint16_t                cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -141,6 +169,33 @@ typedef struct _rpc_sync_info_t {
         uint8_t s2m_length;
     } payload;
 } rpc_sync_info_t;
+
+#    ifdef SPLIT_RPC_MAILBOX_ENABLE
+// Each mailbox record is laid out as a 3-byte header (transaction ID, m2s length, s2m length) followed by the m2s payload
+#        define RPC_MAILBOX_M2S_RECORD_HEADER_SIZE 3
+// Each response record is laid out as a 2-byte header (transaction ID, s2m length) followed by the s2m payload
+#        define RPC_MAILBOX_S2M_RECORD_HEADER_SIZE 2
+
+typedef struct _rpc_mailbox_m2s_t {
+    uint8_t checksum;
+    struct {
+        uint8_t sequence;
+        uint8_t count;
+        uint8_t length;
+        uint8_t data[RPC_MAILBOX_M2S_BUFFER_SIZE];
+    } payload;
+} rpc_mailbox_m2s_t;
+
+typedef struct _rpc_mailbox_s2m_t {
+    uint8_t checksum;
+    struct {
+        uint8_t sequence;
+        uint8_t count;
+        uint8_t length;
+        uint8_t data[RPC_MAILBOX_S2M_BUFFER_SIZE];
+    } payload;
+} rpc_mailbox_s2m_t;
+#    endif // SPLIT_RPC_MAILBOX_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -226,6 +281,10 @@ typedef struct _split_shared_memory_t {
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
     uint8_t         rpc_s2m_buffer[RPC_S2M_BUFFER_SIZE];
+#    ifdef SPLIT_RPC_MAILBOX_ENABLE
+    rpc_mailbox_m2s_t rpc_mailbox_m2s;
+    rpc_mailbox_s2m_t rpc_mailbox_s2m;
+#    endif // SPLIT_RPC_MAILBOX_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
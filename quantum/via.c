@@ -41,6 +41,10 @@
 #    include "audio.h"
 #endif
 
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+#    include "pointing_device.h"
+#endif
+
 #if defined(BACKLIGHT_ENABLE)
 #    include "backlight.h"
 #endif
@@ -213,9 +217,20 @@ bool process_record_via(uint16_t keycode, keyrecord_t *record) {
 
 // This is the default handler for "extra" custom values, i.e. keyboard-specific custom values
 // that are not handled by via_custom_value_command().
+//
+// Pointer acceleration has no channel of its own in the VIA protocol, so by default its values
+// are handled on id_custom_channel. Keyboards overriding this can call
+// via_qmk_pointing_accel_command() from their own handler instead.
 __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
     uint8_t *command_id = &(data[0]);
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+    uint8_t *channel_id = &(data[1]);
+    if (*channel_id == id_custom_channel) {
+        via_qmk_pointing_accel_command(data, length);
+        return;
+    }
+#endif // POINTING_DEVICE_ACCEL_ENABLE
     // Return the unhandled state
     *command_id = id_unhandled;
 }
@@ -876,3 +891,103 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+
+void via_qmk_pointing_accel_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_pointing_accel_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_pointing_accel_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            via_qmk_pointing_accel_save();
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_accel_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t                       *value_id   = &(data[0]);
+    uint8_t                       *value_data = &(data[1]);
+    pointing_device_accel_config_t config     = pointing_device_accel_get_config();
+    switch (*value_id) {
+        case id_qmk_pointing_accel_enable: {
+            value_data[0] = config.enable ? 1 : 0;
+            break;
+        }
+        case id_qmk_pointing_accel_curve: {
+            value_data[0] = config.curve;
+            break;
+        }
+        case id_qmk_pointing_accel_offset: {
+            value_data[0] = config.offset;
+            break;
+        }
+        case id_qmk_pointing_accel_growth: {
+            value_data[0] = config.growth;
+            break;
+        }
+        case id_qmk_pointing_accel_base: {
+            value_data[0] = config.base;
+            break;
+        }
+        case id_qmk_pointing_accel_limit: {
+            value_data[0] = config.limit;
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_accel_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t                       *value_id   = &(data[0]);
+    uint8_t                       *value_data = &(data[1]);
+    pointing_device_accel_config_t config     = pointing_device_accel_get_config();
+    switch (*value_id) {
+        case id_qmk_pointing_accel_enable: {
+            config.enable = value_data[0] ? 1 : 0;
+            break;
+        }
+        case id_qmk_pointing_accel_curve: {
+            config.curve = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_offset: {
+            config.offset = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_growth: {
+            config.growth = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_base: {
+            config.base = value_data[0];
+            break;
+        }
+        case id_qmk_pointing_accel_limit: {
+            config.limit = value_data[0];
+            break;
+        }
+    }
+    pointing_device_accel_set_config_noeeprom(config);
+}
+
+void via_qmk_pointing_accel_save(void) {
+    pointing_device_accel_save();
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -123,6 +123,15 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_pointing_accel_value {
+    id_qmk_pointing_accel_enable = 1,
+    id_qmk_pointing_accel_curve  = 2,
+    id_qmk_pointing_accel_offset = 3,
+    id_qmk_pointing_accel_growth = 4,
+    id_qmk_pointing_accel_base   = 5,
+    id_qmk_pointing_accel_limit  = 6,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +197,10 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(POINTING_DEVICE_ACCEL_ENABLE)
+void via_qmk_pointing_accel_command(uint8_t *data, uint8_t length);
+void via_qmk_pointing_accel_set_value(uint8_t *data);
+void via_qmk_pointing_accel_get_value(uint8_t *data);
+void via_qmk_pointing_accel_save(void);
+#endif
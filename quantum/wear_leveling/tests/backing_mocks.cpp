@@ -23,6 +23,13 @@ void MockBackingStore::reset_instance() {
     backing_erase_invoke_count  = 0;
     backing_write_invoke_count  = 0;
     backing_lock_invoke_count   = 0;
+    backing_read_invoke_count   = 0;
+
+    backing_elapsed_us           = 0;
+    backing_erase_cost_us        = 0;
+    backing_write_cost_us        = 0;
+    backing_read_request_cost_us = 0;
+    backing_read_element_cost_us = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -56,6 +63,7 @@ bool MockBackingStore::unlock(void) {
 
 bool MockBackingStore::erase(void) {
     ++backing_erase_invoke_count;
+    backing_elapsed_us += backing_erase_cost_us;
 
     // Erase each slot
     for (std::size_t i = 0; i < backing_storage.size(); ++i) {
@@ -77,6 +85,7 @@ bool MockBackingStore::erase(void) {
 
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
+    backing_elapsed_us += backing_write_cost_us;
 
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
@@ -113,11 +122,14 @@ bool MockBackingStore::lock(void) {
     return true;
 }
 
-bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) {
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
 
+    ++backing_read_invoke_count;
+    backing_elapsed_us += backing_read_request_cost_us + backing_read_element_cost_us;
+
     // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
     std::size_t index = address / BACKING_STORE_WRITE_SIZE;
     value             = ~backing_storage[index].get();
@@ -125,6 +137,23 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     return true;
 }
 
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, std::size_t item_count) {
+    // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + (item_count * BACKING_STORE_WRITE_SIZE) <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+
+    ++backing_read_invoke_count;
+    backing_elapsed_us += backing_read_request_cost_us + (item_count * backing_read_element_cost_us);
+
+    // Read and take the complement as we're simulating flash memory -- 0xFF means 0x00
+    std::size_t index = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        values[i] = ~backing_storage[index + i].get();
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backing Implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -152,3 +181,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
@@ -96,6 +96,18 @@ class MockBackingStore {
     std::uint64_t backing_erase_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    std::uint64_t backing_read_invoke_count;
+
+    // Simulated time spent in the backing store, in microseconds
+    std::uint64_t backing_elapsed_us;
+    // Simulated duration of each erase, in microseconds
+    std::uint64_t backing_erase_cost_us;
+    // Simulated duration of each write, in microseconds
+    std::uint64_t backing_write_cost_us;
+    // Simulated fixed overhead of each read request, in microseconds
+    std::uint64_t backing_read_request_cost_us;
+    // Simulated duration of reading each element, in microseconds
+    std::uint64_t backing_read_element_cost_us;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -147,6 +159,25 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
+
+    // Simulated time spent in the backing store
+    std::uint64_t elapsed_us() const {
+        return backing_elapsed_us;
+    }
+    void reset_elapsed() {
+        backing_elapsed_us = 0;
+    }
+    void set_timing(std::uint64_t erase_cost_us, std::uint64_t write_cost_us) {
+        backing_erase_cost_us = erase_cost_us;
+        backing_write_cost_us = write_cost_us;
+    }
+    void set_read_timing(std::uint64_t request_cost_us, std::uint64_t element_cost_us) {
+        backing_read_request_cost_us = request_cost_us;
+        backing_read_element_cost_us = element_cost_us;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -161,7 +192,8 @@ class MockBackingStore {
     bool erase();
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
-    bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read(std::uint32_t address, backing_store_int_t& value);
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count);
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
@@ -0,0 +1,129 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "flash_mocks.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SPI Flash Mock implementation
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MockFlash::reset_instance() {
+    flash_storage.fill(0xFF);
+    sector_erased.fill(true);
+    sector_erase_count.fill(0);
+
+    erase_in_progress = false;
+    erase_sector      = 0;
+    erase_busy_polls  = 0;
+    erase_cost_polls  = 0;
+
+    flash_begin_erase_invoke_count = 0;
+    flash_write_invoke_count       = 0;
+    flash_read_invoke_count        = 0;
+
+    write_log.clear();
+}
+
+void MockFlash::fill_stale(std::uint8_t value) {
+    flash_storage.fill(value);
+    sector_erased.fill(false);
+}
+
+void MockFlash::complete_erase() {
+    if (!erase_in_progress) {
+        return;
+    }
+
+    std::uint32_t base = erase_sector * (EXTERNAL_FLASH_SECTOR_SIZE);
+    std::fill(flash_storage.begin() + base, flash_storage.begin() + base + (EXTERNAL_FLASH_SECTOR_SIZE), 0xFF);
+    sector_erased[erase_sector] = true;
+    ++sector_erase_count[erase_sector];
+    erase_in_progress = false;
+}
+
+flash_status_t MockFlash::poll_busy() {
+    if (erase_in_progress) {
+        if (erase_busy_polls > 0) {
+            --erase_busy_polls;
+            return FLASH_STATUS_BUSY;
+        }
+        complete_erase();
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t MockFlash::begin_erase_sector(std::uint32_t addr) {
+    ++flash_begin_erase_invoke_count;
+
+    // Mirrors the real driver's limit check, which excludes the final sector
+    EXPECT_EQ(addr % (EXTERNAL_FLASH_SECTOR_SIZE), 0) << "Attempted to erase an unaligned sector";
+    EXPECT_LT(addr + (EXTERNAL_FLASH_SECTOR_SIZE), (EXTERNAL_FLASH_SIZE)) << "Attempted to erase past the end of the flash";
+
+    // The driver waits for the previous operation before issuing the next
+    complete_erase();
+
+    erase_in_progress = true;
+    erase_sector      = addr / (EXTERNAL_FLASH_SECTOR_SIZE);
+    erase_busy_polls  = erase_cost_polls;
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t MockFlash::read_range(std::uint32_t addr, void* buf, std::size_t len) {
+    ++flash_read_invoke_count;
+
+    // The driver waits for any erase in progress before reading
+    complete_erase();
+
+    EXPECT_LE(addr + len, (EXTERNAL_FLASH_SIZE)) << "Attempted to read past the end of the flash";
+    memcpy(buf, &flash_storage[addr], len);
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t MockFlash::write_range(std::uint32_t addr, const void* buf, std::size_t len) {
+    ++flash_write_invoke_count;
+    write_log.emplace_back(addr, len);
+
+    // The driver waits for any erase in progress before programming
+    complete_erase();
+
+    EXPECT_LE(addr + len, (EXTERNAL_FLASH_SIZE)) << "Attempted to write past the end of the flash";
+    EXPECT_EQ(addr / (EXTERNAL_FLASH_PAGE_SIZE), (addr + len - 1) / (EXTERNAL_FLASH_PAGE_SIZE)) << "Page program crossed a page boundary";
+
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(buf);
+    for (std::size_t i = 0; i < len; ++i) {
+        std::uint32_t offset = addr + i;
+        EXPECT_TRUE(sector_erased[offset / (EXTERNAL_FLASH_SECTOR_SIZE)]) << "Attempted write to sector which hasn't been erased, at 0x" << std::hex << offset;
+        EXPECT_EQ(flash_storage[offset], 0xFF) << "Attempted write at address which isn't empty, at 0x" << std::hex << offset;
+        flash_storage[offset] &= p[i];
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SPI Flash API implementation
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void flash_init(void) {}
+
+flash_status_t flash_is_busy(void) {
+    return MockFlash::Instance().poll_busy();
+}
+
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
+    return MockFlash::Instance().begin_erase_sector(addr);
+}
+
+flash_status_t flash_wait_erase_sector(void) {
+    MockFlash::Instance().complete_erase();
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_read_range(uint32_t addr, void* buf, size_t len) {
+    return MockFlash::Instance().read_range(addr, buf, len);
+}
+
+flash_status_t flash_write_range(uint32_t addr, const void* buf, size_t len) {
+    return MockFlash::Instance().write_range(addr, buf, len);
+}
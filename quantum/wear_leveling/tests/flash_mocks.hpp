@@ -0,0 +1,86 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+extern "C" {
+#include "flash_spi.h"
+};
+
+// Simulated SPI NOR flash, emulating erases of all bytes=0xFF and page programs which can only clear bits
+class MockFlash {
+   private:
+    MockFlash() {
+        reset_instance();
+    }
+
+    // The actual data stored in the emulated flash
+    std::array<std::uint8_t, EXTERNAL_FLASH_SIZE> flash_storage;
+    // Whether each sector has been erased since it was last programmed, or since it was filled with stale data
+    std::array<bool, EXTERNAL_FLASH_SECTOR_COUNT> sector_erased;
+    // The number of times each sector has been erased
+    std::array<std::uint64_t, EXTERNAL_FLASH_SECTOR_COUNT> sector_erase_count;
+
+    // The sector currently being erased, if any
+    bool          erase_in_progress;
+    std::uint32_t erase_sector;
+    // The number of busy polls remaining before the in-progress erase completes
+    std::uint64_t erase_busy_polls;
+    // The number of busy polls each erase takes to complete
+    std::uint64_t erase_cost_polls;
+
+    // The number of times each API was invoked
+    std::uint64_t flash_begin_erase_invoke_count;
+    std::uint64_t flash_write_invoke_count;
+    std::uint64_t flash_read_invoke_count;
+
+    // The address and length of each page program, in order
+    std::vector<std::pair<std::uint32_t, std::size_t>> write_log;
+
+   public:
+    static MockFlash& Instance() {
+        static MockFlash instance;
+        return instance;
+    }
+
+    void reset_instance();
+
+    // Fills the flash with data left over from previous use, so that anything not erased first reads back as garbage
+    void fill_stale(std::uint8_t value);
+
+    void set_erase_cost_polls(std::uint64_t polls) {
+        erase_cost_polls = polls;
+    }
+
+    bool is_sector_erased(std::uint32_t addr) const {
+        return sector_erased[addr / (EXTERNAL_FLASH_SECTOR_SIZE)];
+    }
+    std::uint64_t sector_erase_count_at(std::uint32_t addr) const {
+        return sector_erase_count[addr / (EXTERNAL_FLASH_SECTOR_SIZE)];
+    }
+    bool is_busy() const {
+        return erase_in_progress;
+    }
+
+    std::uint64_t begin_erase_invoke_count() const {
+        return flash_begin_erase_invoke_count;
+    }
+    std::uint64_t write_invoke_count() const {
+        return flash_write_invoke_count;
+    }
+    std::uint64_t read_invoke_count() const {
+        return flash_read_invoke_count;
+    }
+    const std::vector<std::pair<std::uint32_t, std::size_t>>& writes() const {
+        return write_log;
+    }
+
+    void           complete_erase();
+    flash_status_t poll_busy();
+    flash_status_t begin_erase_sector(std::uint32_t addr);
+    flash_status_t read_range(std::uint32_t addr, void* buf, std::size_t len);
+    flash_status_t write_range(std::uint32_t addr, const void* buf, std::size_t len);
+};
@@ -64,3 +64,52 @@ wear_leveling_8byte_SRC := \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
 	$(wear_leveling_common_INC)
+
+wear_leveling_write_cache_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128 \
+	-DWEAR_LEVELING_WRITE_CACHE_ENABLE \
+	-DWEAR_LEVELING_WRITE_CACHE_ENTRIES=8 \
+	-DWEAR_LEVELING_WRITE_CACHE_MAX_LENGTH=16 \
+	-DWEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE=32
+wear_leveling_write_cache_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_cache.cpp
+wear_leveling_write_cache_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_playback_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=16384 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=4096
+wear_leveling_playback_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_playback.cpp
+wear_leveling_playback_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_flash_spi_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=256 \
+	-DEXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN=0 \
+	-DEXTERNAL_FLASH_PAGE_SIZE=64 \
+	-DEXTERNAL_FLASH_SECTOR_SIZE=256 \
+	-DEXTERNAL_FLASH_BLOCK_SIZE=1024 \
+	-DEXTERNAL_FLASH_SIZE=4096
+wear_leveling_flash_spi_SRC := \
+	$(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+	$(LIB_PATH)/fnv/hash_32a.c \
+	$(LIB_PATH)/fnv/hash_64a.c \
+	$(QUANTUM_PATH)/wear_leveling/wear_leveling.c \
+	$(DRIVER_PATH)/wear_leveling/wear_leveling_flash_spi.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/flash_mocks.cpp \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_flash_spi.cpp
+wear_leveling_flash_spi_INC := \
+	$(wear_leveling_common_INC) \
+	$(DRIVER_PATH)/flash \
+	$(DRIVER_PATH)/wear_leveling
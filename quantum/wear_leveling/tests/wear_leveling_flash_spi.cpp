@@ -0,0 +1,243 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "flash_mocks.hpp"
+
+extern "C" {
+#include "wear_leveling.h"
+#include "wear_leveling_internal.h"
+};
+
+// Number of backing store elements in each flash page and sector
+using PAGE_ELEMENTS   = std::integral_constant<std::size_t, (EXTERNAL_FLASH_PAGE_SIZE) / sizeof(backing_store_int_t)>;
+using SECTOR_ELEMENTS = std::integral_constant<std::size_t, (EXTERNAL_FLASH_SECTOR_SIZE) / sizeof(backing_store_int_t)>;
+using SECTOR_COUNT    = std::integral_constant<std::size_t, (WEAR_LEVELING_BACKING_SIZE) / (EXTERNAL_FLASH_SECTOR_SIZE)>;
+
+class WearLevelingFlashSPI : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockFlash::Instance().reset_instance();
+    }
+
+    // Initialises the backing store and erases it, leaving it unlocked and ready for writes
+    void init_and_erase() {
+        EXPECT_TRUE(backing_store_init()) << "Init returned incorrect status";
+        EXPECT_TRUE(backing_store_erase()) << "Erase returned incorrect status";
+        EXPECT_TRUE(backing_store_unlock()) << "Unlock returned incorrect status";
+    }
+
+    // Invokes the backing store task until any queued erases have been issued, then lets the final erase run to completion
+    void run_task_until_idle() {
+        for (int i = 0; i < 1000; ++i) {
+            backing_store_task();
+        }
+        EXPECT_EQ(flash_wait_erase_sector(), FLASH_STATUS_SUCCESS) << "Flash still busy after idling";
+    }
+
+    void verify_readback(uint32_t address, const backing_store_int_t* expected, size_t item_count) {
+        std::vector<backing_store_int_t> readback(item_count);
+        EXPECT_TRUE(backing_store_read_bulk(address, readback.data(), item_count)) << "Read returned incorrect status";
+        for (size_t i = 0; i < item_count; ++i) {
+            EXPECT_EQ(readback[i], expected[i]) << "Readback mismatch at index " << i;
+        }
+    }
+};
+
+/**
+ * This test verifies that data still sitting in the page buffer is visible to reads, and is programmed before the read.
+ */
+TEST_F(WearLevelingFlashSPI, ReadBufferedData) {
+    auto& inst = MockFlash::Instance();
+    init_and_erase();
+
+    backing_store_int_t values[3] = {0x1111, 0x2222, 0x3333};
+    EXPECT_TRUE(backing_store_write_bulk(0, values, 3)) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Partial page should have been buffered";
+
+    verify_readback(0, values, 3);
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Buffered data should have been programmed in a single operation";
+
+    // Reading the buffered data shouldn't lose anything further written contiguously afterwards
+    backing_store_int_t more = 0x4444;
+    EXPECT_TRUE(backing_store_write(3 * sizeof(backing_store_int_t), more)) << "Write returned incorrect status";
+    verify_readback(3 * sizeof(backing_store_int_t), &more, 1);
+    verify_readback(0, values, 3);
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 2) << "Nothing should have been left to program on lock";
+}
+
+/**
+ * This test verifies that contiguous writes are programmed a page at a time, and that a write spanning pages is split.
+ */
+TEST_F(WearLevelingFlashSPI, ContiguousWritesProgramPerPage) {
+    auto& inst = MockFlash::Instance();
+    init_and_erase();
+
+    std::vector<backing_store_int_t> values(PAGE_ELEMENTS::value * 2 + 2);
+    std::iota(values.begin(), values.end(), 1);
+
+    EXPECT_TRUE(backing_store_write_bulk(0, values.data(), PAGE_ELEMENTS::value)) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Full page should have been programmed immediately";
+
+    EXPECT_TRUE(backing_store_write_bulk(EXTERNAL_FLASH_PAGE_SIZE, &values[PAGE_ELEMENTS::value], PAGE_ELEMENTS::value + 2)) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 2) << "Only the filled page should have been programmed";
+
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+    ASSERT_EQ(inst.writes().size(), 3) << "Remainder should have been programmed on lock";
+    const std::uint32_t expected_address[] = {0, EXTERNAL_FLASH_PAGE_SIZE, 2 * EXTERNAL_FLASH_PAGE_SIZE};
+    const std::size_t   expected_length[]  = {EXTERNAL_FLASH_PAGE_SIZE, EXTERNAL_FLASH_PAGE_SIZE, 2 * sizeof(backing_store_int_t)};
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(inst.writes()[i].first, expected_address[i]) << "Page program at incorrect address";
+        EXPECT_EQ(inst.writes()[i].second, expected_length[i]) << "Page program had incorrect length";
+    }
+
+    verify_readback(0, values.data(), values.size());
+}
+
+/**
+ * This test verifies that non-contiguous writes flush the page buffer, and each lands at the correct address.
+ */
+TEST_F(WearLevelingFlashSPI, NonContiguousWritesFlush) {
+    auto& inst = MockFlash::Instance();
+    init_and_erase();
+
+    const std::uint32_t       addresses[] = {0, 4 * sizeof(backing_store_int_t), 1 * sizeof(backing_store_int_t), EXTERNAL_FLASH_SECTOR_SIZE + sizeof(backing_store_int_t)};
+    const backing_store_int_t values[]    = {0xAAAA, 0xBBBB, 0xCCCC, 0xDDDD};
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_TRUE(backing_store_write(addresses[i], values[i])) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Each discontinuity should have flushed the previous write";
+
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+    ASSERT_EQ(inst.writes().size(), 4) << "Last write should have been programmed on lock";
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(inst.writes()[i].first, addresses[i]) << "Write landed at incorrect address";
+        EXPECT_EQ(inst.writes()[i].second, sizeof(backing_store_int_t)) << "Write had incorrect length";
+        verify_readback(addresses[i], &values[i], 1);
+    }
+
+    // Untouched slots in between should still read back as erased
+    backing_store_int_t zero = 0;
+    verify_readback(2 * sizeof(backing_store_int_t), &zero, 1);
+    verify_readback(3 * sizeof(backing_store_int_t), &zero, 1);
+}
+
+/**
+ * This test verifies that writes across the whole backing store only ever land in sectors which have already been erased,
+ * even when the erases are slow and the flash previously held stale data.
+ */
+TEST_F(WearLevelingFlashSPI, WritesOnlyLandInErasedSectors) {
+    auto& inst = MockFlash::Instance();
+    inst.fill_stale(0x5A);
+    inst.set_erase_cost_polls(1000);
+    init_and_erase();
+
+    // Write odd-sized chunks so that writes straddle page and sector boundaries; the mock flags any write to an unerased sector
+    std::vector<backing_store_int_t> values((WEAR_LEVELING_BACKING_SIZE) / sizeof(backing_store_int_t));
+    std::iota(values.begin(), values.end(), 0x100);
+    for (size_t i = 0; i < values.size(); i += 3) {
+        size_t count = std::min<size_t>(3, values.size() - i);
+        EXPECT_TRUE(backing_store_write_bulk(i * sizeof(backing_store_int_t), &values[i], count)) << "Write returned incorrect status";
+        backing_store_task();
+    }
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+
+    verify_readback(0, values.data(), values.size());
+    for (size_t i = 0; i < SECTOR_COUNT::value; ++i) {
+        EXPECT_EQ(inst.sector_erase_count_at(i * (EXTERNAL_FLASH_SECTOR_SIZE)), 1) << "Each sector should have been erased exactly once";
+    }
+}
+
+/**
+ * This test verifies that the empty slot following a write never reads back stale data, as playback stops at the first empty slot.
+ */
+TEST_F(WearLevelingFlashSPI, SlotAfterWriteIsErased) {
+    auto& inst = MockFlash::Instance();
+    inst.fill_stale(0x5A);
+    inst.set_erase_cost_polls(1000);
+    init_and_erase();
+
+    // Finish a write at the very end of the first sector, so the following slot is in a sector which hasn't been touched yet
+    backing_store_int_t value = 0x1234;
+    EXPECT_TRUE(backing_store_write((EXTERNAL_FLASH_SECTOR_SIZE) - sizeof(backing_store_int_t), value)) << "Write returned incorrect status";
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+    EXPECT_TRUE(inst.is_sector_erased(EXTERNAL_FLASH_SECTOR_SIZE)) << "Sector following the write should have been erased";
+
+    backing_store_int_t zero = 0;
+    verify_readback(EXTERNAL_FLASH_SECTOR_SIZE, &zero, 1);
+
+    // Reads further ahead also wait for the erases in between
+    verify_readback((WEAR_LEVELING_BACKING_SIZE) - sizeof(backing_store_int_t), &zero, 1);
+}
+
+/**
+ * This test verifies that queued erases progress from the backing store task alone, without any reads or writes.
+ */
+TEST_F(WearLevelingFlashSPI, TaskProgressesEraseWhenIdle) {
+    auto& inst = MockFlash::Instance();
+    inst.fill_stale(0x5A);
+    inst.set_erase_cost_polls(2);
+    init_and_erase();
+    EXPECT_EQ(inst.begin_erase_invoke_count(), 1) << "Erase should only have issued the first sector";
+
+    run_task_until_idle();
+    EXPECT_EQ(inst.begin_erase_invoke_count(), SECTOR_COUNT::value) << "Task should have issued the remaining sector erases";
+    EXPECT_EQ(inst.read_invoke_count(), 0) << "Flash should not have been read";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Flash should not have been written";
+    for (size_t i = 0; i < SECTOR_COUNT::value; ++i) {
+        EXPECT_TRUE(inst.is_sector_erased(i * (EXTERNAL_FLASH_SECTOR_SIZE))) << "Sector should have been erased";
+    }
+}
+
+/**
+ * This test verifies that subsequent erases only erase the sectors written since the previous erase.
+ */
+TEST_F(WearLevelingFlashSPI, EraseOnlyWrittenSectors) {
+    auto& inst = MockFlash::Instance();
+    init_and_erase();
+    run_task_until_idle();
+
+    backing_store_int_t value = 0x1234;
+    EXPECT_TRUE(backing_store_write(EXTERNAL_FLASH_SECTOR_SIZE, value)) << "Write returned incorrect status";
+    EXPECT_TRUE(backing_store_lock()) << "Lock returned incorrect status";
+
+    EXPECT_TRUE(backing_store_erase()) << "Erase returned incorrect status";
+    run_task_until_idle();
+
+    EXPECT_EQ(inst.sector_erase_count_at(0), 2) << "First sector should have been erased again";
+    EXPECT_EQ(inst.sector_erase_count_at(EXTERNAL_FLASH_SECTOR_SIZE), 2) << "Written sector should have been erased again";
+    for (size_t i = 2; i < SECTOR_COUNT::value; ++i) {
+        EXPECT_EQ(inst.sector_erase_count_at(i * (EXTERNAL_FLASH_SECTOR_SIZE)), 1) << "Unwritten sector should not have been erased again";
+    }
+
+    backing_store_int_t zero = 0;
+    verify_readback(EXTERNAL_FLASH_SECTOR_SIZE, &zero, 1);
+}
+
+/**
+ * This test verifies the wear-leveling algorithm round-trips data through the SPI flash backing store over stale flash.
+ */
+TEST_F(WearLevelingFlashSPI, WearLevelingRoundTrip) {
+    auto& inst = MockFlash::Instance();
+    inst.fill_stale(0x5A);
+    inst.set_erase_cost_polls(3);
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+    verify_data.fill(0);
+    for (uint32_t i = 0; i < 100; ++i) {
+        std::uint8_t  value[3] = {(std::uint8_t)(i | 0x80), (std::uint8_t)(i * 7), (std::uint8_t)(i * 13)};
+        std::uint32_t address  = (i * 11) % (WEAR_LEVELING_LOGICAL_SIZE - sizeof(value));
+        memcpy(&verify_data[address], value, sizeof(value));
+        EXPECT_NE(wear_leveling_write(address, value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+    }
+
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-init returned incorrect status";
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Read returned incorrect status";
+    EXPECT_EQ(readback, verify_data) << "Readback did not match written data";
+}
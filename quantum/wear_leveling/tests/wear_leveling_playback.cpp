@@ -0,0 +1,114 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <iostream>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// Simulated read timings, roughly matching a SPI flash read command (opcode, address, dummy cycles) and data clocked out at ~8MHz
+using READ_REQUEST_COST_US = std::integral_constant<std::uint64_t, 20>;
+using READ_ELEMENT_COST_US = std::integral_constant<std::uint64_t, 2>;
+
+// Number of bytes available to the write log
+using LOG_SIZE = std::integral_constant<std::uint32_t, (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8)>;
+
+class WearLevelingPlayback : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        verify_data.fill(0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Readback did not match written data";
+    }
+
+    // Appends 3-byte writes to the log until it has been filled to the requested number of bytes, returning the number of bytes used
+    std::uint32_t fill_log(std::uint32_t target_bytes) {
+        auto&         inst  = MockBackingStore::Instance();
+        std::uint32_t index = 0;
+        while (inst.total_write_count() * BACKING_STORE_WRITE_SIZE < target_bytes) {
+            // 3-byte multi-byte entries are an odd number of backing store writes, so entries straddle the playback buffer boundaries
+            std::uint8_t  value[3] = {(std::uint8_t)(index | 0x80), (std::uint8_t)(index >> 8 | 0x80), (std::uint8_t)(index * 3 | 0x80)};
+            std::uint32_t address  = 64 + ((index * 3) % (WEAR_LEVELING_LOGICAL_SIZE - 64 - sizeof(value)));
+            EXPECT_EQ(test_write(address, value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+            ++index;
+        }
+        EXPECT_EQ(inst.erase_invoke_count(), 0) << "Log should not have been consolidated";
+        return inst.total_write_count() * BACKING_STORE_WRITE_SIZE;
+    }
+};
+
+/**
+ * This test verifies that the write log is played back correctly when entries straddle the read-ahead buffer boundaries.
+ */
+TEST_F(WearLevelingPlayback, EntriesStraddlingBuffer_Readback) {
+    fill_log(WEAR_LEVELING_PLAYBACK_BUFFER_SIZE * 4);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that playback stops at the first empty slot, even if it's within the same read-ahead block.
+ */
+TEST_F(WearLevelingPlayback, EmptyLog_SingleBlockRead) {
+    auto& inst = MockBackingStore::Instance();
+
+    inst.reset_instance();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+    // Consolidated data, checksum, then a single read-ahead block of the log
+    EXPECT_EQ(inst.read_invoke_count(), 3) << "Unexpected number of reads";
+    verify_readback();
+}
+
+/**
+ * Boot-time benchmark: measures simulated init time against how full the write log is. Playback is expected to scale
+ * with the log size in read-ahead blocks, not the number of log entries.
+ */
+TEST_F(WearLevelingPlayback, InitTimeVsLogFill) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (int percent : {0, 25, 50, 75, 95}) {
+        inst.reset_instance();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        verify_data.fill(0);
+
+        const std::uint32_t log_bytes = fill_log((LOG_SIZE::value * percent) / 100);
+        const std::uint64_t entries   = inst.write_invoke_count();
+
+        inst.set_read_timing(READ_REQUEST_COST_US::value, READ_ELEMENT_COST_US::value);
+        inst.reset_elapsed();
+        const std::uint64_t reads = inst.read_invoke_count();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        const std::uint64_t init_reads = inst.read_invoke_count() - reads;
+        const std::uint64_t init_us    = inst.elapsed_us();
+        inst.set_read_timing(0, 0);
+
+        std::cout << "[ BENCH    ] log " << percent << "% full (" << log_bytes << " bytes): init " << init_us << "us, " << init_reads << " reads" << std::endl;
+
+        // Consolidated data + checksum, then one read per read-ahead block of log (plus the block containing the terminator)
+        const std::uint64_t max_reads = 2 + (log_bytes / WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) + 1;
+        EXPECT_LE(init_reads, max_reads) << "Playback should read the log in bulk";
+
+        // Reading every backing store element of the log individually would incur the request overhead per element
+        const std::uint64_t per_entry_us = entries * (READ_REQUEST_COST_US::value + READ_ELEMENT_COST_US::value);
+        if (entries > 0) {
+            EXPECT_LT(init_us, per_entry_us) << "Playback should be cheaper than reading each entry individually";
+        }
+
+        verify_readback();
+    }
+}
@@ -0,0 +1,206 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// Simulated backing store timings, roughly matching a page erase and a half-word program on typical MCU flash
+using ERASE_COST_US = std::integral_constant<std::uint64_t, 20000>;
+using WRITE_COST_US = std::integral_constant<std::uint64_t, 50>;
+
+class WearLevelingWriteCache : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        MockBackingStore::Instance().set_timing(ERASE_COST_US::value, WRITE_COST_US::value);
+        wear_leveling_init();
+        verify_data.fill(0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_readback() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, verify_data) << "Readback did not match written data";
+    }
+};
+
+/**
+ * This test verifies that writes only update the cache, and are written to the backing store by the task.
+ */
+TEST_F(WearLevelingWriteCache, WritesDeferredUntilTask) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(test_write(0x42, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.unlock_invoke_count(), 0) << "Unlock should not have been invoked";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+    EXPECT_TRUE(wear_leveling_busy()) << "Write should be pending";
+
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_GT(inst.write_invoke_count(), 0) << "Write should have been invoked";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once";
+    EXPECT_FALSE(wear_leveling_busy()) << "Nothing should be pending";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that repeated and adjacent writes are merged into a single pending range before hitting the log.
+ */
+TEST_F(WearLevelingWriteCache, AdjacentWritesMerged) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Byte-by-byte writes of an ascending sequence, with the first byte rewritten a few times
+    for (uint8_t i = 0; i < 4; ++i) {
+        uint8_t value = 0x80 + i;
+        EXPECT_EQ(test_write(0x40, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    for (uint8_t i = 1; i < WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH; ++i) {
+        EXPECT_EQ(test_write(0x40 + i, &i, sizeof(i)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+
+    // A single task invocation should write everything, as it's all within one pending range
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_FALSE(wear_leveling_busy()) << "Nothing should be pending";
+
+    // Multi-byte log entries are 4 backing writes for up to 5 bytes
+    const std::uint64_t merged_writes = ((WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * 4;
+    EXPECT_LE(inst.write_invoke_count(), merged_writes) << "Writes should have been merged";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that running out of pending entries writes the oldest entry synchronously.
+ */
+TEST_F(WearLevelingWriteCache, CacheFull_OldestFlushed) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Non-adjacent writes, one per pending entry
+    for (uint8_t i = 0; i < WEAR_LEVELING_WRITE_CACHE_ENTRIES; ++i) {
+        uint8_t value = 0x30 + i;
+        EXPECT_EQ(test_write(0x40 + i * 2, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked";
+
+    uint8_t value = 0x55;
+    EXPECT_EQ(test_write(0x70, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_GT(inst.write_invoke_count(), 0) << "Oldest entry should have been written";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Erase should not have been invoked";
+    EXPECT_TRUE(wear_leveling_busy()) << "Remaining entries should still be pending";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_busy()) << "Nothing should be pending";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that a steady stream of writes, serviced by the task, never stalls the caller on an erase. Each
+ * task invocation is bounded to the cost of a single erase, or a single chunk/pending range of writes.
+ */
+TEST_F(WearLevelingWriteCache, SteadyWrites_BoundedTiming) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Worst case for a single pending range: every byte written as a multi-byte log entry
+    const std::uint64_t max_range_cost = ((WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES) * 4 * WRITE_COST_US::value;
+    const std::uint64_t max_chunk_cost = (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE / BACKING_STORE_WRITE_SIZE) * WRITE_COST_US::value;
+    const std::uint64_t max_task_cost  = std::max({ERASE_COST_US::value, max_range_cost, max_chunk_cost});
+
+    std::uint64_t max_write_elapsed = 0;
+    std::uint64_t max_task_elapsed  = 0;
+    std::uint64_t erases_in_write   = 0;
+
+    for (int i = 0; i < 2000; ++i) {
+        uint16_t value   = (uint16_t)(i * 7 + 3);
+        uint32_t address = 0x40 + ((i * 6) % (WEAR_LEVELING_LOGICAL_SIZE - 0x40 - sizeof(value)));
+
+        inst.reset_elapsed();
+        std::uint64_t erases = inst.erase_invoke_count();
+        EXPECT_NE(test_write(address, &value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write returned incorrect status";
+        erases_in_write += inst.erase_invoke_count() - erases;
+        max_write_elapsed = std::max(max_write_elapsed, inst.elapsed_us());
+
+        inst.reset_elapsed();
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task returned incorrect status";
+        max_task_elapsed = std::max(max_task_elapsed, inst.elapsed_us());
+    }
+
+    EXPECT_EQ(max_write_elapsed, 0) << "Writes should only touch the cache";
+    EXPECT_EQ(erases_in_write, 0) << "Erase should never occur within a write";
+    EXPECT_LE(max_task_elapsed, max_task_cost) << "Task invocation exceeded its time budget";
+    EXPECT_GT(inst.erasure_count(), 0) << "Background consolidation should have occurred";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that writes made while background consolidation is in progress are retained.
+ */
+TEST_F(WearLevelingWriteCache, WritesDuringConsolidation_Retained) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Fill the log until it passes the consolidation threshold
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(test_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    for (int i = 0; inst.erase_invoke_count() == 0; ++i) {
+        uint8_t value = (uint8_t)i;
+        EXPECT_EQ(test_write(0x40, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    }
+    EXPECT_TRUE(wear_leveling_busy()) << "Consolidation should be in progress";
+
+    // Modify data on either side of the first consolidated chunk
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    uint8_t first = 0xA5;
+    uint8_t last  = 0x5A;
+    EXPECT_EQ(test_write(0, &first, sizeof(first)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, &last, sizeof(last)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    // Drain everything, which should complete consolidation before writing the log
+    int steps = 0;
+    while (wear_leveling_busy()) {
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task returned incorrect status";
+        ASSERT_LT(++steps, 100) << "Task failed to make progress";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Only one erase should have occurred";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback();
+}
+
+/**
+ * This test verifies that an erase discards anything pending.
+ */
+TEST_F(WearLevelingWriteCache, Erase_DiscardsPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_val = 0x14;
+    EXPECT_EQ(test_write(0x42, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_FALSE(wear_leveling_busy()) << "Nothing should be pending";
+
+    std::uint64_t write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Write should not have been invoked";
+
+    verify_data.fill(0);
+    verify_readback();
+}
@@ -67,7 +67,10 @@
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in bulk, in blocks of
+                WEAR_LEVELING_PLAYBACK_BUFFER_SIZE bytes, so that backing stores
+                with a high per-read overhead (such as SPI flash) aren't
+                queried once per log entry.
 
         During reads:
             * Logical data is served from the cache.
@@ -77,6 +80,20 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        With WEAR_LEVELING_WRITE_CACHE_ENABLE, writes are deferred:
+            * The cache is updated with the new data.
+            * The modified range is recorded as pending, merging with any
+                overlapping or adjacent pending ranges.
+            * wear_leveling_task() appends one pending range to the write log
+                per invocation, reading the latest values from the cache.
+            * Once the write log passes WEAR_LEVELING_CONSOLIDATE_THRESHOLD,
+                wear_leveling_task() consolidates incrementally -- erasing,
+                then writing WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE bytes of
+                consolidated data per invocation, then the checksum. Writes
+                made in the meantime remain pending until it completes.
+            * Consolidation only occurs synchronously if the write log is
+                completely full, or if the pending ranges overflow.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -156,6 +173,26 @@
         ╚════════════════╝
         0 <= Address <= 0x3FFE (16382) */
 
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+/**
+ * A range of logical data which has been modified in the cache, but not yet written to the backing store.
+ */
+typedef struct wear_leveling_pending_t {
+    uint32_t address;
+    uint16_t length;
+} wear_leveling_pending_t;
+
+/**
+ * Background consolidation state.
+ */
+typedef enum wear_leveling_consolidation_state_t {
+    CONSOLIDATION_IDLE = 0,
+    CONSOLIDATION_ERASE,
+    CONSOLIDATION_WRITE_DATA,
+    CONSOLIDATION_WRITE_CHECKSUM,
+} wear_leveling_consolidation_state_t;
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
+
 /**
  * Storage area for the wear-leveling cache.
  */
@@ -163,6 +200,13 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+    wear_leveling_pending_t             pending[(WEAR_LEVELING_WRITE_CACHE_ENTRIES)];
+    uint8_t                             pending_count;
+    wear_leveling_consolidation_state_t consolidation_state;
+    uint32_t                            consolidation_offset;
+    uint64_t                            consolidation_hash;
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
 } wear_leveling;
 
 /**
@@ -249,6 +293,30 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+/**
+ * Writes the FNV1a_64 checksum of the consolidated data, directly after the consolidated data.
+ * Pre-condition: the backing store is unlocked.
+ */
+static wear_leveling_status_t wear_leveling_write_checksum(uint64_t hash) {
+    write_log_entry_t entry;
+    entry.raw64 = hash;
+    wl_dprintf("Writing checksum\n");
+#if BACKING_STORE_WRITE_SIZE == 2
+    if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
+        return WEAR_LEVELING_FAILED;
+    }
+#elif BACKING_STORE_WRITE_SIZE == 4
+    if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
+        return WEAR_LEVELING_FAILED;
+    }
+#elif BACKING_STORE_WRITE_SIZE == 8
+    if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
+        return WEAR_LEVELING_FAILED;
+    }
+#endif
+    return WEAR_LEVELING_CONSOLIDATED;
+}
+
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -266,27 +334,7 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        status = wear_leveling_write_checksum(fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT));
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -470,18 +518,47 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Read-ahead buffer for write log playback.
+ */
+typedef struct wear_leveling_playback_buffer_t {
+    uint32_t            address;
+    uint32_t            count;
+    backing_store_int_t values[(WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+} wear_leveling_playback_buffer_t;
+
+/**
+ * Reads a single value from the write log during playback, refilling the read-ahead buffer in bulk as required.
+ */
+static bool wear_leveling_playback_read(wear_leveling_playback_buffer_t *buffer, uint32_t address, backing_store_int_t *value) {
+    if (address < buffer->address || address >= buffer->address + (buffer->count * (BACKING_STORE_WRITE_SIZE))) {
+        const uint32_t remaining = (WEAR_LEVELING_BACKING_SIZE)-address;
+        const uint32_t length    = remaining >= (WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) ? (WEAR_LEVELING_PLAYBACK_BUFFER_SIZE) : remaining;
+        buffer->address          = address;
+        buffer->count            = 0;
+        if (!backing_store_read_bulk(address, buffer->values, length / (BACKING_STORE_WRITE_SIZE))) {
+            return false;
+        }
+        buffer->count = length / (BACKING_STORE_WRITE_SIZE);
+    }
+
+    *value = buffer->values[(address - buffer->address) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling_playback_buffer_t buffer          = {0};
+    wear_leveling_status_t          status          = WEAR_LEVELING_SUCCESS;
+    bool                            cancel_playback = false;
+    uint32_t                        address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&buffer, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -510,7 +587,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&buffer, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -530,7 +607,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -540,7 +617,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -551,7 +628,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&buffer, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -612,6 +689,268 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+/**
+ * Discards all pending ranges and any in-progress background consolidation.
+ */
+static void wear_leveling_reset_deferred(void) {
+    wear_leveling.pending_count        = 0;
+    wear_leveling.consolidation_state  = CONSOLIDATION_IDLE;
+    wear_leveling.consolidation_offset = 0;
+    wear_leveling.consolidation_hash   = FNV1A_64_INIT;
+}
+
+/**
+ * Performs a single step of background consolidation.
+ *
+ * The write log is only considered cleared once the erase step has completed, and the consolidated data is only
+ * considered valid once the checksum has been written -- the same power-loss characteristics as a forced consolidation.
+ */
+static wear_leveling_status_t wear_leveling_consolidation_step(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    switch (wear_leveling.consolidation_state) {
+        case CONSOLIDATION_ERASE:
+            // The backing store API only permits erasing the whole store, so this is the single longest step.
+            wl_dprintf("Erasing backing store\n");
+            if (!backing_store_erase()) {
+                wl_dprintf("Failed to erase backing store\n");
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            // Anything written to the log before the erase is captured in the cache, so there's nothing left pending.
+            wear_leveling.pending_count        = 0;
+            wear_leveling.write_address        = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+            wear_leveling.consolidation_offset = 0;
+            wear_leveling.consolidation_hash   = FNV1A_64_INIT;
+            wear_leveling.consolidation_state  = CONSOLIDATION_WRITE_DATA;
+            break;
+
+        case CONSOLIDATION_WRITE_DATA: {
+            const uint32_t offset    = wear_leveling.consolidation_offset;
+            const uint32_t remaining = (WEAR_LEVELING_LOGICAL_SIZE)-offset;
+            const uint32_t length    = remaining >= (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE) ? (WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE) : remaining;
+            wl_dprintf("Writing consolidated data, offset %d\n", (int)offset);
+            if (!backing_store_write_bulk(offset, (backing_store_int_t *)&wear_leveling.cache[offset], length / sizeof(backing_store_int_t))) {
+                wl_dprintf("Failed to write to backing store\n");
+                status = WEAR_LEVELING_FAILED;
+                break;
+            }
+
+            // The checksum covers exactly what was written, even if the cache is modified while consolidation is in progress
+            wear_leveling.consolidation_hash = fnv_64a_buf(&wear_leveling.cache[offset], length, wear_leveling.consolidation_hash);
+            wear_leveling.consolidation_offset += length;
+            if (wear_leveling.consolidation_offset >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.consolidation_state = CONSOLIDATION_WRITE_CHECKSUM;
+            }
+        } break;
+
+        case CONSOLIDATION_WRITE_CHECKSUM:
+            status = wear_leveling_write_checksum(wear_leveling.consolidation_hash);
+            if (status != WEAR_LEVELING_FAILED) {
+                wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (status == WEAR_LEVELING_FAILED) {
+        // Partially-written consolidated data cannot be trusted, start again from the erase on the next step
+        wear_leveling.consolidation_state = CONSOLIDATION_ERASE;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Completes any in-progress background consolidation.
+ */
+static wear_leveling_status_t wear_leveling_consolidation_complete(void) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (wear_leveling.consolidation_state != CONSOLIDATION_IDLE) {
+        status = wear_leveling_consolidation_step();
+        if (status == WEAR_LEVELING_FAILED) {
+            // Retry on a subsequent invocation rather than spinning here
+            break;
+        }
+    }
+    return status;
+}
+
+/**
+ * Writes the oldest pending range to the write log, using the current contents of the cache.
+ */
+static wear_leveling_status_t wear_leveling_pending_flush_one(void) {
+    if (wear_leveling.pending_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    const wear_leveling_pending_t entry = wear_leveling.pending[0];
+    wear_leveling.pending_count--;
+    memmove(&wear_leveling.pending[0], &wear_leveling.pending[1], wear_leveling.pending_count * sizeof(wear_leveling_pending_t));
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Perform the actual write
+    wear_leveling_status_t status = wear_leveling_write_raw(entry.address, &wear_leveling.cache[entry.address], entry.length);
+    switch (status) {
+        case WEAR_LEVELING_CONSOLIDATED:
+        case WEAR_LEVELING_FAILED:
+            // If the write triggered consolidation, or the write failed, then nothing else needs to occur.
+            break;
+
+        case WEAR_LEVELING_SUCCESS:
+            // Consolidate the cache + write log if required
+            status = wear_leveling_consolidate_if_needed();
+            break;
+
+        default:
+            // Unsure how we'd get here...
+            status = WEAR_LEVELING_FAILED;
+            break;
+    }
+
+    // Consolidation wrote the whole cache, including anything else that was pending
+    if (status == WEAR_LEVELING_CONSOLIDATED) {
+        wear_leveling.pending_count = 0;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Records a modified range of the cache as pending, merging with existing pending ranges where possible.
+ * If there's no room for a new range, the oldest pending range is written synchronously.
+ */
+static wear_leveling_status_t wear_leveling_pending_add(uint32_t address, size_t length) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (length > 0) {
+        const uint32_t this_length = length >= (WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH) ? (WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH) : (uint32_t)length;
+        const uint32_t this_end    = address + this_length;
+        bool           merged      = false;
+
+        // Merge with an overlapping or adjacent range, if the result fits within a single entry
+        for (uint8_t i = 0; i < wear_leveling.pending_count; ++i) {
+            wear_leveling_pending_t *entry     = &wear_leveling.pending[i];
+            const uint32_t           entry_end = entry->address + entry->length;
+            if (address <= entry_end && entry->address <= this_end) {
+                const uint32_t merged_start = address < entry->address ? address : entry->address;
+                const uint32_t merged_end   = this_end > entry_end ? this_end : entry_end;
+                if (merged_end - merged_start <= (WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH)) {
+                    entry->address = merged_start;
+                    entry->length  = (uint16_t)(merged_end - merged_start);
+                    merged         = true;
+                    break;
+                }
+            }
+        }
+
+        if (!merged) {
+            if (wear_leveling.pending_count >= (WEAR_LEVELING_WRITE_CACHE_ENTRIES)) {
+                // Out of room -- the log can't be written while consolidation is in progress, so finish that first
+                wl_dprintf("Write cache full, flushing synchronously\n");
+                wear_leveling_status_t flush_status = wear_leveling_consolidation_complete();
+                if (flush_status != WEAR_LEVELING_FAILED) {
+                    flush_status = wear_leveling_pending_flush_one();
+                }
+                if (flush_status == WEAR_LEVELING_FAILED) {
+                    return WEAR_LEVELING_FAILED;
+                }
+                if (flush_status == WEAR_LEVELING_CONSOLIDATED) {
+                    // The cache, including this write, has been consolidated in its entirety
+                    status = WEAR_LEVELING_CONSOLIDATED;
+                    break;
+                }
+            }
+
+            wear_leveling.pending[wear_leveling.pending_count].address = address;
+            wear_leveling.pending[wear_leveling.pending_count].length  = (uint16_t)this_length;
+            wear_leveling.pending_count++;
+        }
+
+        address += this_length;
+        length -= this_length;
+    }
+
+    return status;
+}
+
+/**
+ * Performs a single step of deferred work.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    // Give the backing store a chance to progress any background work of its own
+    backing_store_task();
+
+    if (wear_leveling.consolidation_state != CONSOLIDATION_IDLE) {
+        return wear_leveling_consolidation_step();
+    }
+
+    // Consolidation takes priority over pending writes, otherwise a steady stream of writes could fill the log
+    if (wear_leveling.write_address >= (WEAR_LEVELING_CONSOLIDATE_THRESHOLD)) {
+        wl_dprintf("Write log past threshold, starting background consolidation\n");
+        wear_leveling.consolidation_state = CONSOLIDATION_ERASE;
+        return wear_leveling_consolidation_step();
+    }
+
+    return wear_leveling_pending_flush_one();
+}
+
+/**
+ * Writes all pending data to the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    wear_leveling_status_t status = wear_leveling_consolidation_complete();
+    if (status == WEAR_LEVELING_FAILED) {
+        return status;
+    }
+
+    while (wear_leveling.pending_count > 0) {
+        wear_leveling_status_t flush_status = wear_leveling_pending_flush_one();
+        if (flush_status == WEAR_LEVELING_FAILED) {
+            return flush_status;
+        }
+        if (flush_status == WEAR_LEVELING_CONSOLIDATED) {
+            status = flush_status;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Checks whether there is deferred work outstanding.
+ */
+bool wear_leveling_busy(void) {
+    return wear_leveling.pending_count > 0 || wear_leveling.consolidation_state != CONSOLIDATION_IDLE;
+}
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
+
 /**
  * Wear-leveling initialization
  */
@@ -620,6 +959,9 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+    wear_leveling_reset_deferred();
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -663,6 +1005,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+    wear_leveling_reset_deferred();
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -692,6 +1037,10 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+    // Defer the write to the backing store, wear_leveling_task() will write it to the log later
+    return wear_leveling_pending_add(address, length);
+#else
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -725,6 +1074,7 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
 }
 
 /**
@@ -767,3 +1117,8 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of the backing store task, drivers can implement background work such as erases.
+ */
+__attribute__((weak)) void backing_store_task(void) {}
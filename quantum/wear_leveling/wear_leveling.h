@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,31 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+/**
+ * Performs a single step of deferred work.
+ *
+ * Writes one pending cache entry to the write log, or advances background consolidation by one step. Intended to be
+ * invoked regularly, such as from the housekeeping task.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
+/**
+ * Writes all pending data to the backing store.
+ *
+ * Completes any background consolidation in progress, then writes all pending cache entries to the write log.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Checks whether there is deferred work outstanding.
+ *
+ * @return true if there is pending data not yet written to the backing store, or consolidation is in progress
+ */
+bool wear_leveling_busy(void);
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
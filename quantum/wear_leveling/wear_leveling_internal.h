@@ -59,10 +59,38 @@ typedef uint64_t backing_store_int_t;
         } while (0)
 #endif // WEAR_LEVELING_ASSERTS
 
+#ifndef WEAR_LEVELING_PLAYBACK_BUFFER_SIZE
+#    define WEAR_LEVELING_PLAYBACK_BUFFER_SIZE 64
+#endif // WEAR_LEVELING_PLAYBACK_BUFFER_SIZE
+
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+#    ifndef WEAR_LEVELING_WRITE_CACHE_ENTRIES
+#        define WEAR_LEVELING_WRITE_CACHE_ENTRIES 16
+#    endif // WEAR_LEVELING_WRITE_CACHE_ENTRIES
+
+#    ifndef WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH
+#        define WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH 64
+#    endif // WEAR_LEVELING_WRITE_CACHE_MAX_LENGTH
+
+#    ifndef WEAR_LEVELING_CONSOLIDATE_THRESHOLD
+#        define WEAR_LEVELING_CONSOLIDATE_THRESHOLD ((WEAR_LEVELING_BACKING_SIZE) - (((WEAR_LEVELING_BACKING_SIZE) - (WEAR_LEVELING_LOGICAL_SIZE) - 8) / 4))
+#    endif // WEAR_LEVELING_CONSOLIDATE_THRESHOLD
+
+#    ifndef WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE
+#        define WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE 64
+#    endif // WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
+
 // Compile-time validation of configurable options
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+STATIC_ASSERT(WEAR_LEVELING_PLAYBACK_BUFFER_SIZE >= BACKING_STORE_WRITE_SIZE && WEAR_LEVELING_PLAYBACK_BUFFER_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback buffer size must be a multiple of write size");
+#ifdef WEAR_LEVELING_WRITE_CACHE_ENABLE
+STATIC_ASSERT(WEAR_LEVELING_WRITE_CACHE_ENTRIES > 0, "Write cache must have at least one entry");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATE_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation chunk size must be a multiple of write size");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATE_THRESHOLD <= WEAR_LEVELING_BACKING_SIZE, "Consolidation threshold must be within the backing store");
+#endif // WEAR_LEVELING_WRITE_CACHE_ENABLE
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
@@ -73,6 +101,7 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+void backing_store_task(void);                                                                  // weak implementation already provided, drivers may use it for background work such as erases
 
 /**
  * Helper type used to contain a write log entry.
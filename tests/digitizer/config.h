@@ -0,0 +1,8 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DIGITIZER_REPORT_INTERVAL_MS 2
@@ -0,0 +1,112 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "digitizer.h"
+}
+
+static std::vector<report_digitizer_t> reports;
+
+extern "C" void send_digitizer(report_digitizer_t *report) {
+    reports.push_back(*report);
+}
+
+class Digitizer : public TestFixture {
+   public:
+    void SetUp() override {
+        // Start every test from a report the host has already seen
+        digitizer_state = {};
+        run_one_scan_loop();
+        digitizer_state.dirty = true;
+        digitizer_flush();
+        reports.clear();
+    }
+
+   protected:
+    TestDriver driver;
+
+    static digitizer_sample_t sample(uint16_t x, uint16_t y, bool tip = false) {
+        digitizer_sample_t sample = {};
+        sample.in_range           = true;
+        sample.tip                = tip;
+        sample.x                  = x;
+        sample.y                  = y;
+        return sample;
+    }
+};
+
+#define EXPECT_DIGITIZER_REPORT(report, x_, y_, tip_) \
+    do {                                             \
+        report_digitizer_t r = (report);             \
+        EXPECT_TRUE(r.in_range);                     \
+        EXPECT_EQ(r.x, x_);                          \
+        EXPECT_EQ(r.y, y_);                          \
+        EXPECT_EQ(r.tip, tip_);                      \
+    } while (0)
+
+TEST_F(Digitizer, SamplesAreBatchedPerInterval) {
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    digitizer_push_sample(sample(10, 10));
+    digitizer_push_sample(sample(20, 30));
+    digitizer_push_sample(sample(40, 50));
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_DIGITIZER_REPORT(reports[0], 40, 50, false);
+
+    // Samples arriving before the interval has passed wait for the next report
+    digitizer_push_sample(sample(60, 70));
+    run_one_scan_loop();
+    EXPECT_EQ(reports.size(), 1);
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_DIGITIZER_REPORT(reports[1], 60, 70, false);
+    EXPECT_FLOAT_EQ(digitizer_state.x, 60.0f / DIGITIZER_POSITION_MAX);
+}
+
+TEST_F(Digitizer, SwitchChangesAreNotMerged) {
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    digitizer_push_sample(sample(10, 10));
+    digitizer_push_sample(sample(20, 20, true));
+    digitizer_push_sample(sample(30, 30, true));
+    digitizer_push_sample(sample(30, 30));
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS * 3);
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_DIGITIZER_REPORT(reports[0], 10, 10, false);
+    EXPECT_DIGITIZER_REPORT(reports[1], 30, 30, true);
+    EXPECT_DIGITIZER_REPORT(reports[2], 30, 30, false);
+}
+
+TEST_F(Digitizer, UnchangedReportIsNotResent) {
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    digitizer_push_sample(sample(100, 100));
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    digitizer_push_sample(sample(100, 100));
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    EXPECT_EQ(reports.size(), 1);
+
+    // The immediate API is deduplicated against queued reports too
+    digitizer_state.dirty = true;
+    digitizer_flush();
+    EXPECT_EQ(reports.size(), 1);
+    digitizer_tip_switch_on();
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_DIGITIZER_REPORT(reports[1], 100, 100, true);
+}
+
+TEST_F(Digitizer, FullQueueKeepsLatestPositionAndSwitchChanges) {
+    idle_for(DIGITIZER_REPORT_INTERVAL_MS);
+    for (uint16_t i = 1; i <= DIGITIZER_SAMPLE_QUEUE_SIZE * 2; i++) {
+        EXPECT_TRUE(digitizer_push_sample(sample(i, i)));
+    }
+    // A switch change cannot be merged into a full queue, so the caller is told to retry
+    EXPECT_FALSE(digitizer_push_sample(sample(0, 0, true)));
+
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_DIGITIZER_REPORT(reports[0], DIGITIZER_SAMPLE_QUEUE_SIZE * 2, DIGITIZER_SAMPLE_QUEUE_SIZE * 2, false);
+    EXPECT_TRUE(digitizer_push_sample(sample(0, 0, true)));
+}
@@ -0,0 +1,3 @@
+MOUSEKEY_ENABLE = yes
+POINTING_DEVICE_ENABLE = yes
+POINTING_DEVICE_DRIVER = custom
@@ -0,0 +1,207 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" void advance_time(uint32_t ms);
+
+using testing::_;
+
+struct MouseTravel {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+};
+
+class MousekeyTimeIntegrated : public TestFixture {
+   protected:
+    // Holds the key for duration milliseconds, running the keyboard task every scan_interval milliseconds, and returns
+    // the total motion reported on each axis
+    MouseTravel hold(KeymapKey &key, uint16_t duration, uint16_t scan_interval) {
+        TestDriver  driver;
+        MouseTravel total = {};
+        EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly([&](report_mouse_t &report) {
+            total.x += report.x;
+            total.y += report.y;
+            total.h += report.h;
+            total.v += report.v;
+        });
+
+        key.press();
+        run_one_scan_loop();
+        for (uint16_t elapsed = scan_interval; elapsed <= duration; elapsed += scan_interval) {
+            advance_time(scan_interval - 1);
+            run_one_scan_loop();
+        }
+        key.release();
+        run_one_scan_loop();
+
+        VERIFY_AND_CLEAR(driver);
+        return total;
+    }
+
+    // Distance covered by the default acceleration curve after accelerating for held milliseconds
+    static double reference_distance(double held, double max_unit, double time_to_max, double interval) {
+        const double step     = 0.01;
+        double       distance = 0;
+        for (double t = step / 2; t < held; t += step) {
+            // no slower than one unit per interval
+            distance += std::max(max_unit * std::min((t + interval) / (time_to_max * interval), 1.0), 1.0) / interval * step;
+        }
+        return distance;
+    }
+};
+
+TEST_F(MousekeyTimeIntegrated, TapMovesOneStep) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+
+    set_keymap({mouse_key});
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSEKEY_MOVE_DELTA, 0, 0, 0, 0));
+    mouse_key.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyTimeIntegrated, NoMotionDuringDelay) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_UP};
+
+    set_keymap({mouse_key});
+
+    EXPECT_MOUSE_REPORT(driver, (0, -MOUSEKEY_MOVE_DELTA, 0, 0, 0));
+    mouse_key.press();
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(MOUSEKEY_DELAY);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyTimeIntegrated, SlowMotionIsCarriedBetweenReports) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+
+    set_keymap({mouse_key});
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSEKEY_MOVE_DELTA, 0, 0, 0, 0));
+    mouse_key.press();
+    run_one_scan_loop();
+
+    // Well below a pixel per millisecond, so every report moves a single pixel as soon as one has been covered
+    const int expected = reference_distance(40, MOUSEKEY_MOVE_DELTA * MOUSEKEY_MAX_SPEED, MOUSEKEY_TIME_TO_MAX, MOUSEKEY_INTERVAL);
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0)).Times(expected);
+    idle_for(MOUSEKEY_DELAY + 40);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyTimeIntegrated, TravelFollowsAccelerationCurve) {
+    KeymapKey mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_LEFT};
+    set_keymap({mouse_key});
+
+    const uint16_t duration = 1000;
+    const double   expected = MOUSEKEY_MOVE_DELTA + reference_distance(duration - MOUSEKEY_DELAY, MOUSEKEY_MOVE_DELTA * MOUSEKEY_MAX_SPEED, MOUSEKEY_TIME_TO_MAX, MOUSEKEY_INTERVAL);
+
+    MouseTravel total = hold(mouse_key, duration, 1);
+    EXPECT_NEAR(-total.x, expected, 2);
+    EXPECT_EQ(total.y, 0);
+}
+
+TEST_F(MousekeyTimeIntegrated, TravelIsIndependentOfScanRate) {
+    KeymapKey mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_DOWN};
+    set_keymap({mouse_key});
+
+    // A multiple of every scan interval, so each run ends at the same time
+    const uint16_t duration  = 7 * 5 * 3 * 2 * 4;
+    MouseTravel    reference = hold(mouse_key, duration, 1);
+
+    for (uint16_t scan_interval : {2, 3, 5, 7}) {
+        MouseTravel total = hold(mouse_key, duration, scan_interval);
+        EXPECT_NEAR(total.y, reference.y, 1) << "scanning every " << scan_interval << "ms";
+    }
+}
+
+TEST_F(MousekeyTimeIntegrated, DiagonalTravelIsScaled) {
+    KeymapKey right_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+    KeymapKey down_key  = KeymapKey{0, 1, 0, QK_MOUSE_CURSOR_DOWN};
+    set_keymap({right_key, down_key});
+
+    const uint16_t duration = 500;
+    MouseTravel    straight = hold(right_key, duration, 1);
+
+    TestDriver driver;
+    EXPECT_MOUSE_REPORT(driver, (MOUSEKEY_MOVE_DELTA, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (MOUSEKEY_MOVE_DELTA, MOUSEKEY_MOVE_DELTA, 0, 0, 0));
+    right_key.press();
+    down_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    MouseTravel total = {};
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly([&](report_mouse_t &report) {
+        total.x += report.x;
+        total.y += report.y;
+    });
+    idle_for(duration);
+    VERIFY_AND_CLEAR(driver);
+
+    const double expected = (straight.x - MOUSEKEY_MOVE_DELTA) * 181.0 / 256.0;
+    EXPECT_NEAR(total.x, expected, 1);
+    EXPECT_EQ(total.y, total.x);
+
+    EXPECT_ANY_MOUSE_REPORT(driver).Times(2);
+    right_key.release();
+    down_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyTimeIntegrated, WheelTapScrollsOneNotch) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_WHEEL_UP};
+
+    set_keymap({mouse_key});
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, MOUSEKEY_WHEEL_DELTA * pointing_device_get_hires_scroll_resolution(), 0));
+    mouse_key.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyTimeIntegrated, WheelScrollsInFractionsOfANotch) {
+    KeymapKey mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_WHEEL_DOWN};
+    set_keymap({mouse_key});
+
+    const uint16_t resolution = pointing_device_get_hires_scroll_resolution();
+    const uint16_t duration   = 2000;
+    const double   notches    = MOUSEKEY_WHEEL_DELTA + reference_distance(duration - MOUSEKEY_WHEEL_DELAY, MOUSEKEY_WHEEL_DELTA * MOUSEKEY_WHEEL_MAX_SPEED, MOUSEKEY_WHEEL_TIME_TO_MAX, MOUSEKEY_WHEEL_INTERVAL);
+
+    MouseTravel total = hold(mouse_key, duration, 1);
+    EXPECT_NEAR(-total.v, notches * resolution, resolution / 10);
+}
@@ -0,0 +1,183 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+static pointing_device_accel_config_t make_config(pointing_device_accel_curve_t curve, uint8_t offset, uint8_t growth, uint8_t base, uint8_t limit) {
+    pointing_device_accel_config_t config = {};
+    config.enable                         = true;
+    config.curve                          = curve;
+    config.offset                         = offset;
+    config.growth                         = growth;
+    config.base                           = base;
+    config.limit                          = limit;
+    return config;
+}
+
+// Floating point version of the curves, with speed in counts per millisecond
+static double reference_gain(const pointing_device_accel_config_t &config, double speed) {
+    // Speeds past the end of the lookup table use its last entry
+    speed               = std::min(speed, (POINTING_DEVICE_ACCEL_TABLE_SIZE - 1) * POINTING_DEVICE_ACCEL_TABLE_STEP / 16.0);
+    const double offset = config.offset / 16.0;
+    const double base   = config.base / 16.0;
+    const double limit  = std::max(config.limit, config.base) / 16.0;
+    double       gain;
+    if (config.curve == POINTING_DEVICE_ACCEL_CURVE_SIGMOID) {
+        gain = base + (limit - base) / (1.0 + std::exp(-(speed - offset) * config.growth / 16.0));
+    } else {
+        gain = base + std::max(speed - offset, 0.0) * config.growth / 256.0;
+    }
+    return std::min(gain, limit);
+}
+
+// Rounding, plus the error of interpolating linearly between table entries, which grows with the curve's steepness
+static double reference_tolerance(const pointing_device_accel_config_t &config) {
+    const double step = POINTING_DEVICE_ACCEL_TABLE_STEP / 16.0;
+    if (config.curve == POINTING_DEVICE_ACCEL_CURVE_SIGMOID) {
+        // The logistic function's second derivative is at most 0.1 times its steepness squared
+        const double span      = std::max(config.limit - config.base, 0) / 16.0;
+        const double steepness = config.growth / 16.0;
+        return 0.02 + span * 0.1 * steepness * steepness * step * step / 8;
+    }
+    // Only the corner where the line meets the limit is interpolated over
+    return 0.02 + config.growth / 256.0 * step / 4;
+}
+
+static report_mouse_t motion(mouse_xy_report_t x, mouse_xy_report_t y) {
+    report_mouse_t report = {};
+    report.x              = x;
+    report.y              = y;
+    return report;
+}
+
+class PointingAccel : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_SIGMOID, POINTING_DEVICE_ACCEL_DEFAULT_OFFSET, POINTING_DEVICE_ACCEL_DEFAULT_GROWTH, POINTING_DEVICE_ACCEL_DEFAULT_BASE, POINTING_DEVICE_ACCEL_DEFAULT_LIMIT));
+    }
+};
+
+class PointingAccelCurve : public PointingAccel, public ::testing::WithParamInterface<pointing_device_accel_config_t> {};
+
+TEST_P(PointingAccelCurve, GainMatchesReference) {
+    const pointing_device_accel_config_t config = GetParam();
+    pointing_device_accel_set_config_noeeprom(config);
+
+    for (uint16_t speed = 0; speed <= POINTING_DEVICE_ACCEL_TABLE_SIZE * POINTING_DEVICE_ACCEL_TABLE_STEP + 64; speed++) {
+        EXPECT_NEAR(pointing_device_accel_gain(speed) / 256.0, reference_gain(config, speed / 16.0), reference_tolerance(config)) << "speed " << speed / 16.0 << " counts/ms";
+    }
+}
+
+TEST_P(PointingAccelCurve, MotionMatchesReference) {
+    const pointing_device_accel_config_t config = GetParam();
+    pointing_device_accel_set_config_noeeprom(config);
+
+    for (int16_t x = 1; x <= 40; x++) {
+        const int16_t                 y      = -x / 2;
+        pointing_device_accel_state_t state  = {};
+        report_mouse_t                report = pointing_device_accel_apply(&state, motion(x, y), 1);
+        const double                  gain   = reference_gain(config, std::sqrt(x * x + y * y));
+        const double                  error  = 1.0 + x * reference_tolerance(config);
+        EXPECT_NEAR(report.x, std::min(x * gain, (double)MOUSE_REPORT_XY_MAX), error) << "x " << x;
+        EXPECT_NEAR(report.y, std::max(y * gain, (double)MOUSE_REPORT_XY_MIN), error) << "x " << x;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Curves, PointingAccelCurve,
+                        ::testing::Values(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 32, 16, 16, 64),   //
+                                          make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 40, 8, 255),    //
+                                          make_config(POINTING_DEVICE_ACCEL_CURVE_SIGMOID, 96, 8, 16, 48),   //
+                                          make_config(POINTING_DEVICE_ACCEL_CURVE_SIGMOID, 200, 32, 4, 80),  //
+                                          make_config(POINTING_DEVICE_ACCEL_CURVE_SIGMOID, 64, 4, 32, 16))); // limit below base
+
+TEST_F(PointingAccel, RemainderIsCarried) {
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 0, 24, 24));
+
+    pointing_device_accel_state_t state = {};
+    int32_t                       total = 0;
+    for (int i = 0; i < 100; i++) {
+        total += pointing_device_accel_apply(&state, motion(1, 0), 1).x;
+    }
+    EXPECT_EQ(total, 150);
+}
+
+TEST_F(PointingAccel, NegativeMotion) {
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 0, 24, 24));
+
+    pointing_device_accel_state_t state = {};
+    int32_t                       total = 0;
+    for (int i = 0; i < 100; i++) {
+        report_mouse_t report = pointing_device_accel_apply(&state, motion(-1, -3), 1);
+        total += report.x;
+        EXPECT_GE(report.y, -5);
+        EXPECT_LE(report.y, -4);
+    }
+    EXPECT_EQ(total, -150);
+}
+
+TEST_F(PointingAccel, SpeedNormalisedToReferenceCpi) {
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 64, 16, 255));
+
+    pointing_device_accel_state_t reference = {.cpi = POINTING_DEVICE_ACCEL_REFERENCE_CPI};
+    pointing_device_accel_state_t doubled   = {.cpi = POINTING_DEVICE_ACCEL_REFERENCE_CPI * 2};
+
+    // The same physical motion produces twice the counts at twice the CPI, and should have the same gain applied
+    EXPECT_EQ(pointing_device_accel_apply(&reference, motion(10, 0), 1).x * 2, pointing_device_accel_apply(&doubled, motion(20, 0), 1).x);
+}
+
+TEST_F(PointingAccel, SpeedUsesElapsedTime) {
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 64, 16, 255));
+
+    pointing_device_accel_state_t fast = {};
+    pointing_device_accel_state_t slow = {};
+    EXPECT_GT(pointing_device_accel_apply(&fast, motion(10, 0), 1).x, pointing_device_accel_apply(&slow, motion(10, 0), 10).x);
+}
+
+TEST_F(PointingAccel, DisabledPassesThrough) {
+    pointing_device_accel_config_t config = make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 255, 64, 255);
+    config.enable                         = false;
+    pointing_device_accel_set_config_noeeprom(config);
+
+    pointing_device_accel_state_t state  = {};
+    report_mouse_t                report = motion(-7, 100);
+    report.h                             = 3;
+    report.buttons                       = 1;
+
+    report_mouse_t result = pointing_device_accel_apply(&state, report, 1);
+    EXPECT_FALSE(has_mouse_report_changed(&report, &result));
+}
+
+TEST_F(PointingAccel, InvalidCurveRejected) {
+    const pointing_device_accel_config_t before = pointing_device_accel_get_config();
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_COUNT, 0, 0, 16, 16));
+    EXPECT_EQ(pointing_device_accel_get_config().curve, before.curve);
+}
+
+TEST_F(PointingAccel, AppliedToReports) {
+    TestDriver driver;
+    pointing_device_accel_set_config_noeeprom(make_config(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 0, 0, 24, 24));
+
+    pd_set_x(1);
+    pd_set_y(-2);
+    EXPECT_MOUSE_REPORT(driver, (1, -3, 0, 0, 0));
+    run_one_scan_loop();
+    EXPECT_MOUSE_REPORT(driver, (2, -3, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    pd_set_v(2);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 2, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
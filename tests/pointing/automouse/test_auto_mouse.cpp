@@ -0,0 +1,124 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include "gtest/gtest.h"
+#include "pointing_trace.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+extern "C" void advance_time(uint32_t ms);
+
+static uint32_t layer_changes = 0;
+
+extern "C" layer_state_t layer_state_set_user(layer_state_t state) {
+    layer_changes++;
+    return state;
+}
+
+class AutoMouse : public TestFixture {
+   public:
+    void SetUp() override {
+        set_auto_mouse_enable(true);
+        layer_changes = 0;
+    }
+
+    void TearDown() override {
+        set_auto_mouse_enable(false);
+        layer_clear();
+        TestFixture::TearDown();
+    }
+
+   protected:
+    TestDriver driver;
+
+    // Moves by `step` along X every `interval` ms until `duration` has passed
+    static PointingTrace steady(int16_t step, uint32_t interval, uint32_t duration) {
+        PointingTrace trace;
+        for (uint32_t time = 0; time < duration; time += interval) {
+            trace.samples.push_back({time, step, 0, 0, 0, 0});
+        }
+        return trace;
+    }
+
+    PointingTraceResult replay(const PointingTrace& trace) {
+        PointingTraceOptions options;
+        options.settle_ms = 1;
+        return replay_pointing_trace(driver, trace, options);
+    }
+};
+
+TEST_F(AutoMouse, MotionOverThresholdActivatesLayerOnce) {
+    replay(steady(4, 1, 100));
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    EXPECT_EQ(layer_changes, 1);
+
+    // Once stopped, the layer stays on until activity has decayed and the timeout has passed
+    idle_for(AUTO_MOUSE_TIME);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    idle_for(AUTO_MOUSE_ACTIVITY_HALF_LIFE * 8);
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    EXPECT_EQ(layer_changes, 2);
+    EXPECT_EQ(get_auto_mouse_activity(), 0);
+}
+
+TEST_F(AutoMouse, JitterDoesNotAddUp) {
+    // Far more than AUTO_MOUSE_THRESHOLD in total, but too spread out to ever accumulate to it
+    replay(steady(1, 20, 5000));
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    EXPECT_EQ(layer_changes, 0);
+}
+
+TEST_F(AutoMouse, SlowMotionHoldsButDoesNotActivate) {
+    // Enough to stay over AUTO_MOUSE_HOLD_THRESHOLD, but never over AUTO_MOUSE_THRESHOLD
+    PointingTrace slow = steady(1, 12, AUTO_MOUSE_TIME * 3);
+    replay(slow);
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+
+    replay(steady(4, 1, 20));
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    replay(slow);
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    EXPECT_EQ(layer_changes, 1);
+}
+
+TEST_F(AutoMouse, ButtonActivatesLayer) {
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(2);
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    EXPECT_EQ(layer_changes, 1);
+}
+
+TEST_F(AutoMouse, TypingDelaysActivation) {
+    auto key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(2);
+    tap_key(key);
+    replay(steady(4, 1, AUTO_MOUSE_DELAY / 2));
+    EXPECT_FALSE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+
+    idle_for(AUTO_MOUSE_DELAY);
+    replay(steady(4, 1, 10));
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+}
+
+TEST_F(AutoMouse, ActivatesAcrossTimerWrap) {
+    // Idle state must not depend on where the 16 bit timer is, including just after it wraps to 0
+    advance_time(0x10000 - (timer_read32() & 0xFFFF) + 1);
+    replay(steady(4, 1, 10));
+    EXPECT_TRUE(layer_state_is(AUTO_MOUSE_DEFAULT_LAYER));
+}
+
+TEST_F(AutoMouse, CostPerReport) {
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(4, 60000, 30));
+
+    EXPECT_NO_DROPPED_MOTION(result);
+    EXPECT_GT(layer_changes, 0);
+    std::cout << "[ BENCH    ] auto mouse: " << result << std::endl;
+}
@@ -0,0 +1,121 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "pointing_trace.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingSampling : public TestFixture {};
+
+TEST_F(PointingSampling, SensorNotReadWithoutSamples) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampling, SamplesBetweenScansAreSummed) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_y(-3);
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_set_v(1);
+    pointing_device_sample();
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (30, -9, 0, 1, 0));
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    pointing_device_sample();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampling, MotionBeyondReportIsCarriedOver) {
+    TestDriver driver;
+
+    pd_set_x(MOUSE_REPORT_XY_MAX);
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_set_x(1);
+    pointing_device_sample();
+    pd_clear_movement();
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampling, ClickBetweenScansIsReported) {
+    TestDriver driver;
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_sample();
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_sample();
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampling, KeyButtonHeldWhileSampling) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, QK_MOUSE_BUTTON_2);
+    set_keymap({key});
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 2));
+    key.press();
+    run_one_scan_loop();
+
+    pd_set_x(5);
+    pointing_device_sample();
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (5, 0, 0, 0, 2));
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSampling, NoMotionDroppedWhileStalled) {
+    TestDriver           driver;
+    PointingTraceOptions options;
+    options.stall_every_ms = 50;
+    options.stall_ms       = 45;
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(1, 10000, 60), options);
+
+    EXPECT_NO_DROPPED_MOTION(result);
+}
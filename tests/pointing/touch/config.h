@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_TOUCH_TAP_ENABLE
+#define POINTING_DEVICE_TOUCH_TAPPING_TERM 200
+#define POINTING_DEVICE_TOUCH_SCROLL_DIVISOR 4
+#define POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
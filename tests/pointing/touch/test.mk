@@ -0,0 +1,3 @@
+POINTING_DEVICE_ENABLE = yes
+POINTING_DEVICE_DRIVER = custom
+POINTING_DEVICE_TOUCH_ENABLE = yes
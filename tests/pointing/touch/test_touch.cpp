@@ -0,0 +1,239 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" void advance_time(uint32_t ms);
+
+class PointingTouch : public TestFixture {
+   public:
+    PointingTouch() {
+        pointing_device_touch_reset();
+        pointing_device_touch_enable_tap(true);
+        pointing_device_touch_enable_cursor_glide(false);
+    }
+
+   protected:
+    report_mouse_t last_report = {};
+
+    void touch(uint16_t timestamp, uint16_t x, uint16_t y, uint8_t fingers, bool claimed = false) {
+        touch_event_t event = {};
+        event.timestamp     = timestamp;
+        event.x             = x;
+        event.y             = y;
+        event.fingers       = fingers;
+        event.claimed       = claimed;
+        pointing_device_touch_push(event);
+    }
+
+    void lift(uint16_t timestamp) {
+        touch(timestamp, 0, 0, 0);
+    }
+
+    // Runs the gesture engine as a driver would, with the buttons of the previous report carried in
+    report_mouse_t task(report_mouse_t mouse_report = {}) {
+        mouse_report.buttons |= last_report.buttons;
+        last_report = pointing_device_touch_task(mouse_report);
+        return last_report;
+    }
+};
+
+#define EXPECT_REPORT(report, x_, y_, h_, v_, buttons_) \
+    do {                                                 \
+        report_mouse_t r = (report);                     \
+        EXPECT_EQ(r.x, x_);                              \
+        EXPECT_EQ(r.y, y_);                              \
+        EXPECT_EQ(r.h, h_);                              \
+        EXPECT_EQ(r.v, v_);                              \
+        EXPECT_EQ(r.buttons, buttons_);                  \
+    } while (0)
+
+TEST_F(PointingTouch, OneFingerMovesCursor) {
+    touch(0, 100, 100, 1);
+    touch(10, 110, 95, 1);
+    touch(20, 130, 90, 1);
+    EXPECT_REPORT(task(), 30, -10, 0, 0, 0);
+
+    touch(30, 125, 90, 1);
+    EXPECT_REPORT(task(), -5, 0, 0, 0, 0);
+
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, PositionsWrap) {
+    touch(0, 65530, 2, 1);
+    touch(10, 4, 65534, 1);
+    EXPECT_REPORT(task(), 10, -4, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, MotionBeyondReportIsCarriedOver) {
+    touch(0, 0, 0, 1);
+    touch(10, 2 * MOUSE_REPORT_XY_MAX + 5, 0, 1);
+    EXPECT_REPORT(task(), MOUSE_REPORT_XY_MAX, 0, 0, 0, 0);
+    EXPECT_REPORT(task(), MOUSE_REPORT_XY_MAX, 0, 0, 0, 0);
+    EXPECT_REPORT(task(), 5, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, FingerChangeIsNotMotion) {
+    touch(0, 100, 100, 1);
+    touch(10, 300, 200, 2);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+
+    touch(20, 100, 100, 1);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+
+    touch(30, 102, 101, 1);
+    EXPECT_REPORT(task(), 2, 1, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, TwoFingersScroll) {
+    touch(0, 100, 100, 2);
+    touch(10, 108, 116, 2);
+    EXPECT_REPORT(task(), 0, 0, 2, 4, 0);
+
+    // Motion short of a whole scroll unit is carried into the next report
+    touch(20, 111, 114, 2);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+    touch(30, 112, 112, 2);
+    EXPECT_REPORT(task(), 0, 0, 1, -1, 0);
+}
+
+TEST_F(PointingTouch, TapPressesButtonForOneReport) {
+    touch(0, 100, 100, 1);
+    touch(20, 102, 101, 1);
+    lift(100);
+    EXPECT_REPORT(task(), 2, 1, 0, 0, 1);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, TapButtonFollowsFingers) {
+    touch(0, 100, 100, 2);
+    touch(30, 100, 100, 1);
+    lift(60);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 2);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+
+    touch(100, 100, 100, 1);
+    touch(110, 100, 100, 3);
+    touch(120, 100, 100, 4);
+    lift(150);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 4);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, LongTouchIsNotTap) {
+    touch(0, 100, 100, 1);
+    lift(POINTING_DEVICE_TOUCH_TAPPING_TERM);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, TouchThatMovesIsNotTap) {
+    touch(0, 100, 100, 1);
+    touch(10, 100 + POINTING_DEVICE_TOUCH_TAP_DISTANCE, 100, 1);
+    touch(20, 100 + POINTING_DEVICE_TOUCH_TAP_DISTANCE, 101, 1);
+    lift(30);
+    EXPECT_REPORT(task(), POINTING_DEVICE_TOUCH_TAP_DISTANCE, 1, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, TapCanBeDisabled) {
+    pointing_device_touch_enable_tap(false);
+    touch(0, 100, 100, 1);
+    lift(50);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, ClaimedContactNeitherMovesNorTaps) {
+    touch(0, 100, 100, 1);
+    touch(10, 110, 100, 1, true);
+    touch(20, 120, 100, 1, true);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+
+    // Motion resumes once released, but the touch can no longer be a tap
+    touch(30, 125, 100, 1);
+    lift(40);
+    EXPECT_REPORT(task(), 5, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, ClaimedLiftIsNotTap) {
+    touch(0, 100, 100, 1);
+    touch(50, 0, 0, 0, true);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, TimestampsWrap) {
+    touch(65500, 100, 100, 1);
+    lift(64);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 1);
+}
+
+TEST_F(PointingTouch, FullQueueKeepsAllSamples) {
+    const uint16_t samples = POINTING_DEVICE_TOUCH_QUEUE_SIZE * 3;
+    touch(0, 0, 0, 1);
+    for (uint16_t i = 1; i <= samples; i++) {
+        touch(i, i, 0, 1);
+    }
+    EXPECT_REPORT(task(), samples, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, DriverReportIsKept) {
+    report_mouse_t driver_report = {};
+    driver_report.x              = 3;
+    driver_report.v              = -1;
+    driver_report.buttons        = 8;
+
+    touch(0, 100, 100, 1);
+    touch(10, 104, 100, 1);
+    EXPECT_REPORT(task(driver_report), 7, 0, 0, -1, 8);
+}
+
+TEST_F(PointingTouch, SamplesProcessedWhenSensorRead) {
+    touch(0, 100, 100, 1);
+    touch(10, 106, 98, 1);
+    lift(20);
+    report_mouse_t report = pointing_device_read_sensor({});
+    EXPECT_REPORT(report, 6, -2, 0, 0, 1);
+    EXPECT_REPORT(pointing_device_read_sensor(report), 0, 0, 0, 0, 0);
+}
+
+TEST_F(PointingTouch, CursorGlidesAfterFlick) {
+    pointing_device_touch_enable_cursor_glide(true);
+    touch(0, 100, 100, 1);
+    touch(10, 140, 100, 1);
+    touch(20, 180, 100, 1);
+    EXPECT_REPORT(task(), 80, 0, 0, 0, 0);
+
+    lift(30);
+    int8_t  first = task().x;
+    int32_t glide = first;
+    EXPECT_GT(first, 0);
+
+    // Glide continues without any further samples, slowing until it stops
+    int8_t last = first;
+    for (int i = 0; i < 100; i++) {
+        advance_time(10);
+        report_mouse_t report = task();
+        EXPECT_EQ(report.y, 0);
+        EXPECT_GE(report.x, 0);
+        if (report.x) {
+            last = report.x;
+        }
+        glide += report.x;
+    }
+    EXPECT_LT(last, first);
+    EXPECT_GT(glide, first);
+    advance_time(10);
+    EXPECT_EQ(task().x, 0);
+
+    // Touching again cancels the glide
+    touch(0, 100, 100, 1);
+    touch(10, 140, 100, 1);
+    touch(20, 180, 100, 1);
+    lift(30);
+    task();
+    touch(40, 180, 100, 1);
+    advance_time(10);
+    EXPECT_REPORT(task(), 0, 0, 0, 0, 0);
+}
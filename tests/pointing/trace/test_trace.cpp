@@ -0,0 +1,89 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "pointing_trace.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+class PointingTraceReplay : public TestFixture {};
+
+TEST_F(PointingTraceReplay, LoadSkipsCommentsAndDefaultsFields) {
+    std::istringstream text(
+        "# time x y h v buttons\n"
+        "0 1 2\n"
+        "\n"
+        "5 -3 0 1 -1 2 # click\n"
+        "3 4\n");
+    PointingTrace trace = PointingTrace::load(text);
+
+    ASSERT_EQ(trace.samples.size(), 3);
+    EXPECT_EQ(trace.samples[1].time, 3);
+    EXPECT_EQ(trace.samples[1].x, 4);
+    EXPECT_EQ(trace.samples[1].y, 0);
+    EXPECT_EQ(trace.samples[2].h, 1);
+    EXPECT_EQ(trace.samples[2].v, -1);
+    EXPECT_EQ(trace.samples[2].buttons, 2);
+    EXPECT_EQ(trace.duration(), 5);
+
+    std::ostringstream saved;
+    trace.save(saved);
+    std::istringstream reloaded_text(saved.str());
+    EXPECT_EQ(PointingTrace::load(reloaded_text).totals(), trace.totals());
+}
+
+TEST_F(PointingTraceReplay, ShortTrace) {
+    TestDriver         driver;
+    std::istringstream text(
+        "0 10 -3\n"
+        "1 10 -3\n"
+        "2 0 0 0 1\n"
+        "10 0 0 0 0 1\n"
+        "30 0 0 0 0 0\n");
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::load(text));
+
+    EXPECT_NO_DROPPED_MOTION(result);
+    ASSERT_EQ(result.reports.size(), 5);
+    EXPECT_EQ(result.reports[0].x, 10);
+    EXPECT_EQ(result.reports[2].v, 1);
+    EXPECT_EQ(result.reports[3].time, 10);
+    EXPECT_EQ(result.reports[3].buttons, 1);
+    EXPECT_EQ(result.reports[4].buttons, 0);
+}
+
+TEST_F(PointingTraceReplay, NoMotionDropped) {
+    TestDriver          driver;
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(1, 10000, 20));
+
+    EXPECT_NO_DROPPED_MOTION(result);
+    EXPECT_GT(result.reports.size(), 1000);
+}
+
+TEST_F(PointingTraceReplay, NoMotionDroppedBeyondReportRange) {
+    TestDriver          driver;
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(2, 5000, 400));
+
+    EXPECT_NO_DROPPED_MOTION(result);
+}
+
+TEST_F(PointingTraceReplay, NoMotionDroppedWhileStalled) {
+    TestDriver           driver;
+    PointingTraceOptions options;
+    options.stall_every_ms = 50;
+    options.stall_ms       = 30;
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(3, 10000, 60), options);
+
+    EXPECT_NO_DROPPED_MOTION(result);
+    EXPECT_LT(result.loops, 10000 * 25 / 50);
+}
+
+TEST_F(PointingTraceReplay, CostPerReport) {
+    TestDriver          driver;
+    PointingTraceResult result = replay_pointing_trace(driver, PointingTrace::random(4, 60000, 30));
+
+    EXPECT_NO_DROPPED_MOTION(result);
+    std::cout << "[ BENCH    ] " << result << std::endl;
+}
@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define PS2_MOUSE_USE_PACKET_QUEUE
+#define PS2_MOUSE_ENABLE_SCROLLING
+#define PS2_MOUSE_SCROLL_BTN_MASK 0
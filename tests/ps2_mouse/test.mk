@@ -0,0 +1,2 @@
+PS2_MOUSE_ENABLE = yes
+PS2_DRIVER = vendor
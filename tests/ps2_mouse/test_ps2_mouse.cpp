@@ -0,0 +1,222 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "ps2.h"
+#include "ps2_mouse.h"
+#include "ps2_mock.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class Ps2Mouse : public TestFixture {
+   protected:
+    // Sends a whole packet, as the mouse would in stream mode with scrolling enabled
+    void send_packet(uint8_t status, uint8_t x, uint8_t y, uint8_t v) {
+        ps2_mock_receive(status, true);
+        ps2_mock_receive(x, true);
+        ps2_mock_receive(y, true);
+        ps2_mock_receive(v, true);
+    }
+};
+
+TEST_F(Ps2Mouse, NoReportWithoutPackets) {
+    TestDriver driver;
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, QueuedPacketsAreMerged) {
+    TestDriver driver;
+
+    send_packet(0x08, 10, 5, 0);
+    send_packet(0x08, 10, 5, 0);
+    send_packet(0x08, 1, 0, 0);
+
+    // PS/2 reports y up, HID reports y down
+    EXPECT_MOUSE_REPORT(driver, (21, -10, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, SignedMotionAndScrollAreDecoded) {
+    TestDriver driver;
+
+    // x = -10, y = -5, one notch of the wheel towards the user
+    send_packet(0x38, 0xF6, 0xFB, 0x01);
+
+    EXPECT_MOUSE_REPORT(driver, (-10, 5, 0, -1, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, ButtonChangesAreNotMergedAway) {
+    TestDriver driver;
+    InSequence s;
+
+    send_packet(0x08, 5, 0, 0);
+    send_packet(0x09, 3, 0, 0);
+    send_packet(0x09, 2, 0, 0);
+    send_packet(0x08, 0, 0, 0);
+
+    EXPECT_MOUSE_REPORT(driver, (5, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (5, 0, 0, 0, 1));
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, OverflowIsCarriedIntoLaterReports) {
+    TestDriver driver;
+    InSequence s;
+
+    // X overflow is the largest positive motion, Y overflow with the sign set the largest negative
+    send_packet(0x48, 0x00, 0x00, 0);
+    send_packet(0xA8, 0x00, 0x00, 0);
+
+    EXPECT_MOUSE_REPORT(driver, (127, 127, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (127, 127, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (1, 2, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, CarriedMotionIsReportedAcrossButtonChange) {
+    TestDriver driver;
+    InSequence s;
+
+    send_packet(0x48, 0x00, 0x00, 0);
+    send_packet(0x09, 0x00, 0x00, 0);
+
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    // the remaining motion goes out with the press, rather than being lost or delaying it
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, 0, 1));
+    run_one_scan_loop();
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 1));
+    run_one_scan_loop();
+
+    send_packet(0x08, 0x00, 0x00, 0);
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, BytesBeforePacketStartAreDropped) {
+    TestDriver driver;
+
+    // neither byte has the always-set bit of a first byte
+    ps2_mock_receive(0x01, true);
+    ps2_mock_receive(0x02, true);
+    send_packet(0x08, 4, 0, 0);
+
+    EXPECT_MOUSE_REPORT(driver, (4, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_FALSE(pbuf_has_data());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, BadByteRestartsPacket) {
+    TestDriver driver;
+
+    ps2_mock_receive(0x08, true);
+    ps2_mock_receive(0x10, true);
+    ps2_mock_receive(0x00, false);
+    send_packet(0x08, 1, 0, 0);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, ResynchronisesAfterDroppedByte) {
+    TestDriver driver;
+
+    // the last byte of the first packet is lost, so its assembly takes the start of the next packet
+    ps2_mock_receive(0x08, true);
+    ps2_mock_receive(0x05, true);
+    ps2_mock_receive(0x05, true);
+    send_packet(0x08, 2, 0, 0);
+
+    EXPECT_ANY_MOUSE_REPORT(driver).Times(testing::AnyNumber());
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // the rest of that packet has no first byte, so the next whole packet is found again
+    send_packet(0x08, 3, 0, 0);
+    EXPECT_MOUSE_REPORT(driver, (3, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, FullQueueDropsNewestPackets) {
+    TestDriver driver;
+
+    // one slot is always left free
+    for (int i = 0; i < PS2_MOUSE_PACKET_QUEUE_SIZE + 4; i++) {
+        send_packet(0x08, 1, 0, 0);
+    }
+
+    EXPECT_MOUSE_REPORT(driver, (PS2_MOUSE_PACKET_QUEUE_SIZE - 1, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Ps2Mouse, CommandResponsesBypassPackets) {
+    TestDriver driver;
+
+    ps2_mouse_disable_data_reporting();
+    ps2_mock_receive(PS2_ACK, true);
+    ASSERT_TRUE(pbuf_has_data());
+    EXPECT_EQ(ps2_host_recv_response(), PS2_ACK);
+
+    // anything left unread when packets resume is stale
+    ps2_mock_receive(0x55, true);
+    ps2_mouse_enable_data_reporting();
+    EXPECT_FALSE(pbuf_has_data());
+
+    send_packet(0x08, 6, 0, 0);
+    EXPECT_FALSE(pbuf_has_data());
+
+    EXPECT_MOUSE_REPORT(driver, (6, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
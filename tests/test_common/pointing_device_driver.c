@@ -16,6 +16,10 @@ typedef struct {
     int16_t           h;
     int16_t           v;
     pd_button_state_t button_state[8];
+    int32_t           pending_x; // motion added since the last read, as a sensor's delta registers would hold it
+    int32_t           pending_y;
+    int32_t           pending_h;
+    int32_t           pending_v;
     uint16_t          cpi;
     bool              initiated;
 } pd_config_t;
@@ -27,6 +31,17 @@ bool pointing_device_driver_init(void) {
     return pd_config.initiated;
 }
 
+static inline int32_t pd_constrain(int32_t value, int32_t min, int32_t max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+// Reports the set motion plus as much pending motion as fits, keeping the rest pending
+static int32_t pd_take_pending(int32_t *pending, int32_t set, int32_t min, int32_t max) {
+    int32_t taken = pd_constrain(set + *pending, min, max);
+    *pending -= taken - pd_constrain(set, min, max);
+    return taken;
+}
+
 report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
     for (uint8_t i = 0; i < 8; i++) {
         if (pd_config.button_state[i].dirty) {
@@ -38,10 +53,10 @@ report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
             }
         }
     }
-    mouse_report.x = pd_config.x;
-    mouse_report.y = pd_config.y;
-    mouse_report.h = pd_config.h;
-    mouse_report.v = pd_config.v;
+    mouse_report.x = pd_take_pending(&pd_config.pending_x, pd_config.x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y = pd_take_pending(&pd_config.pending_y, pd_config.y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h = pd_take_pending(&pd_config.pending_h, pd_config.h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v = pd_take_pending(&pd_config.pending_v, pd_config.v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
     return mouse_report;
 }
 
@@ -103,6 +118,17 @@ void pd_clear_movement(void) {
     pd_set_y(0);
     pd_set_h(0);
     pd_set_v(0);
+    pd_config.pending_x = 0;
+    pd_config.pending_y = 0;
+    pd_config.pending_h = 0;
+    pd_config.pending_v = 0;
+}
+
+void pd_add_movement(int16_t x, int16_t y, int16_t h, int16_t v) {
+    pd_config.pending_x += x;
+    pd_config.pending_y += y;
+    pd_config.pending_h += h;
+    pd_config.pending_v += v;
 }
 
 void pd_set_init(bool success) {
@@ -0,0 +1,196 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "quantum.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+void PointingTraceTotals::add(const PointingTraceSample& sample, uint8_t previous_buttons) {
+    x += sample.x;
+    y += sample.y;
+    h += sample.h;
+    v += sample.v;
+    for (uint8_t i = 0; i < 8; i++) {
+        if ((sample.buttons & ~previous_buttons) & (1 << i)) {
+            presses[i]++;
+        }
+    }
+}
+
+bool operator==(const PointingTraceTotals& lhs, const PointingTraceTotals& rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.h == rhs.h && lhs.v == rhs.v && std::equal(std::begin(lhs.presses), std::end(lhs.presses), std::begin(rhs.presses));
+}
+
+std::ostream& operator<<(std::ostream& os, const PointingTraceTotals& totals) {
+    os << "(X:" << totals.x << ", Y:" << totals.y << ", H:" << totals.h << ", V:" << totals.v << ", presses:";
+    for (uint8_t i = 0; i < 8; i++) {
+        os << " " << totals.presses[i];
+    }
+    return os << ")";
+}
+
+PointingTrace PointingTrace::load(std::istream& stream) {
+    PointingTrace trace;
+    std::string   line;
+    while (std::getline(stream, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        int64_t            time;
+        if (!(fields >> time)) {
+            continue;
+        }
+        int32_t x = 0, y = 0, h = 0, v = 0, buttons = 0;
+        fields >> x >> y >> h >> v >> buttons;
+        trace.samples.push_back({(uint32_t)time, (int16_t)x, (int16_t)y, (int16_t)h, (int16_t)v, (uint8_t)buttons});
+    }
+    std::stable_sort(trace.samples.begin(), trace.samples.end(), [](const PointingTraceSample& a, const PointingTraceSample& b) { return a.time < b.time; });
+    return trace;
+}
+
+PointingTrace PointingTrace::load(const std::string& path) {
+    std::ifstream stream(path);
+    if (!stream) {
+        ADD_FAILURE() << "Could not open pointing trace " << path;
+        return {};
+    }
+    return load(stream);
+}
+
+void PointingTrace::save(std::ostream& stream) const {
+    for (const auto& sample : samples) {
+        stream << sample.time << " " << sample.x << " " << sample.y << " " << sample.h << " " << sample.v << " " << +sample.buttons << "\n";
+    }
+}
+
+PointingTrace PointingTrace::random(unsigned seed, uint32_t duration_ms, int16_t max_speed) {
+    PointingTrace trace;
+    std::mt19937  rng(seed);
+    auto          between = [&](int32_t low, int32_t high) { return std::uniform_int_distribution<int32_t>(low, high)(rng); };
+    const int32_t jitter  = std::max<int32_t>(max_speed / 8, 1);
+    uint32_t      time    = 0;
+    while (time < duration_ms) {
+        // Pause, sometimes clicking, held for longer than any stall the trace is likely to be replayed with
+        time += between(20, 200);
+        if (between(0, 3) == 0) {
+            trace.samples.push_back({time, 0, 0, 0, 0, (uint8_t)(1 << between(0, 2))});
+            time += between(60, 150);
+            trace.samples.push_back({time, 0, 0, 0, 0, 0});
+            time += between(20, 100);
+        }
+
+        // Stroke, scrolling about one time in five
+        const bool     scroll  = between(0, 4) == 0;
+        const int32_t  speed_x = between(-max_speed, max_speed);
+        const int32_t  speed_y = between(-max_speed, max_speed);
+        const uint32_t end     = time + between(50, 400);
+        if (scroll) {
+            const int16_t  h        = speed_x > 0 ? 1 : -1;
+            const int16_t  v        = speed_y > 0 ? 1 : -1;
+            const uint32_t interval = between(5, 20);
+            for (; time < end; time += interval) {
+                trace.samples.push_back({time, 0, 0, h, v, 0});
+            }
+        } else {
+            for (; time < end; time++) {
+                int16_t x = std::min<int32_t>(std::max<int32_t>(speed_x + between(-jitter, jitter), INT16_MIN), INT16_MAX);
+                int16_t y = std::min<int32_t>(std::max<int32_t>(speed_y + between(-jitter, jitter), INT16_MIN), INT16_MAX);
+                trace.samples.push_back({time, x, y, 0, 0, 0});
+            }
+        }
+    }
+    return trace;
+}
+
+uint32_t PointingTrace::duration() const {
+    return samples.empty() ? 0 : samples.back().time;
+}
+
+PointingTraceTotals PointingTrace::totals() const {
+    PointingTraceTotals totals;
+    uint8_t             buttons = 0;
+    for (const auto& sample : samples) {
+        totals.add(sample, buttons);
+        buttons = sample.buttons;
+    }
+    return totals;
+}
+
+double PointingTraceResult::ns_per_report() const {
+    return reports.empty() ? 0 : (double)task_ns / reports.size();
+}
+
+double PointingTraceResult::ns_per_loop() const {
+    return loops == 0 ? 0 : (double)task_ns / loops;
+}
+
+std::ostream& operator<<(std::ostream& os, const PointingTraceResult& result) {
+    return os << "injected " << result.injected << ", emitted " << result.emitted << " in " << result.reports.size() << " reports over " << result.loops << " loops, " << result.ns_per_report() << "ns per report, " << result.ns_per_loop() << "ns per loop, " << result.max_loop_ns << "ns slowest loop";
+}
+
+PointingTraceResult replay_pointing_trace(TestDriver& driver, const PointingTrace& trace, const PointingTraceOptions& options) {
+    PointingTraceResult result;
+    result.injected = trace.totals();
+
+    const uint32_t start          = timer_read32();
+    uint32_t       last_report    = 0;
+    uint8_t        report_buttons = 0;
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly([&](report_mouse_t& report) {
+        last_report                = timer_read32() - start;
+        PointingTraceSample sample = {last_report, report.x, report.y, report.h, report.v, report.buttons};
+        result.emitted.add(sample, report_buttons);
+        result.reports.push_back(sample);
+        report_buttons = report.buttons;
+    });
+
+    uint8_t        sensor_buttons = 0;
+    size_t         next           = 0;
+    const uint32_t end            = trace.duration();
+    for (uint32_t now = 0; now <= end || (now - MAX(end, last_report) < options.settle_ms && now - end < options.max_settle_ms); now++) {
+        for (; next < trace.samples.size() && trace.samples[next].time <= now; next++) {
+            const PointingTraceSample& sample = trace.samples[next];
+            pd_add_movement(sample.x, sample.y, sample.h, sample.v);
+            for (uint8_t i = 0; i < 8; i++) {
+                if ((sample.buttons ^ sensor_buttons) & (1 << i)) {
+                    sample.buttons & (1 << i) ? pd_press_button(i) : pd_release_button(i);
+                }
+            }
+            sensor_buttons = sample.buttons;
+        }
+
+#ifdef POINTING_DEVICE_BACKGROUND_SAMPLING
+        // Sampling carries on while the main loop is stalled
+        pointing_device_sample();
+#endif
+
+        const bool stalled = options.stall_every_ms && now % options.stall_every_ms < options.stall_ms;
+        if (!stalled) {
+            auto loop_start = std::chrono::steady_clock::now();
+            keyboard_task();
+            uint64_t loop_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - loop_start).count();
+            housekeeping_task();
+
+            result.loops++;
+            result.task_ns += loop_ns;
+            result.max_loop_ns = std::max(result.max_loop_ns, loop_ns);
+        }
+        advance_time(1);
+    }
+
+    testing::Mock::VerifyAndClearExpectations(&driver);
+    pd_clear_movement();
+    return result;
+}
@@ -0,0 +1,104 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "test_driver.hpp"
+
+/**
+ * @brief A sensor sample, or an emitted report, at a time in milliseconds from the start of a trace.
+ */
+struct PointingTraceSample {
+    uint32_t time;
+    int16_t  x;
+    int16_t  y;
+    int16_t  h;
+    int16_t  v;
+    uint8_t  buttons;
+};
+
+/**
+ * @brief Motion summed over a trace, wide enough that long traces cannot overflow.
+ */
+struct PointingTraceTotals {
+    int64_t x = 0;
+    int64_t y = 0;
+    int64_t h = 0;
+    int64_t v = 0;
+    // Number of times each button went from released to pressed
+    uint32_t presses[8] = {};
+
+    void add(const PointingTraceSample& sample, uint8_t previous_buttons);
+};
+
+bool          operator==(const PointingTraceTotals& lhs, const PointingTraceTotals& rhs);
+std::ostream& operator<<(std::ostream& stream, const PointingTraceTotals& value);
+
+/**
+ * @brief A recording of timestamped sensor samples.
+ *
+ * Traces are stored as text, one sample per line as "time x y h v buttons", where trailing fields may be left out and
+ * default to zero, and anything following a '#' is a comment. Buttons are the state of all buttons after the sample.
+ */
+class PointingTrace {
+   public:
+    std::vector<PointingTraceSample> samples;
+
+    static PointingTrace load(std::istream& stream);
+    static PointingTrace load(const std::string& path);
+    void                 save(std::ostream& stream) const;
+
+    /**
+     * @brief Generates a reproducible trace of strokes separated by pauses, as a hand moving a sensor would produce.
+     *
+     * @param seed for the random number generator
+     * @param duration_ms length of the trace
+     * @param max_speed largest motion in a single sample, along each axis
+     */
+    static PointingTrace random(unsigned seed, uint32_t duration_ms, int16_t max_speed);
+
+    uint32_t            duration() const;
+    PointingTraceTotals totals() const;
+};
+
+struct PointingTraceOptions {
+    // Simulates a busy main loop by skipping keyboard_task for stall_ms out of every stall_every_ms
+    uint32_t stall_every_ms = 0;
+    uint32_t stall_ms       = 0;
+    // After the last sample, the replay ends once no report has been sent for settle_ms, or after max_settle_ms
+    uint32_t settle_ms     = 100;
+    uint32_t max_settle_ms = 60000;
+};
+
+struct PointingTraceResult {
+    PointingTraceTotals              injected;
+    PointingTraceTotals              emitted;
+    std::vector<PointingTraceSample> reports; // every report sent to the host, as a trace
+    uint32_t                         loops       = 0;
+    uint64_t                         task_ns     = 0; // time spent in keyboard_task over the whole replay
+    uint64_t                         max_loop_ns = 0;
+
+    double ns_per_report() const;
+    double ns_per_loop() const;
+};
+
+std::ostream& operator<<(std::ostream& stream, const PointingTraceResult& value);
+
+/**
+ * @brief Replays a trace through the custom test pointing device driver and pointing_device_task().
+ *
+ * The driver holds motion injected between reads like a sensor's delta registers, so motion is only lost if QMK drops
+ * it. Each millisecond the samples that are due are injected, and unless the loop is stalled, keyboard_task runs once.
+ * Every mouse report sent to `driver` is recorded, so it must not have other mouse report expectations set.
+ */
+PointingTraceResult replay_pointing_trace(TestDriver& driver, const PointingTrace& trace, const PointingTraceOptions& options = {});
+
+/**
+ * @brief Asserts that every bit of motion in a replayed trace was reported to the host.
+ */
+#define EXPECT_NO_DROPPED_MOTION(result) EXPECT_EQ((result).emitted, (result).injected) << (result)
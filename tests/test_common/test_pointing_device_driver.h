@@ -25,6 +25,9 @@ void pd_clear_v(void);
 
 void pd_clear_movement(void);
 
+// Adds motion that is reported once, spread over as many reads as needed to fit the report's range
+void pd_add_movement(int16_t x, int16_t y, int16_t h, int16_t v);
+
 void pd_set_init(bool success);
 
 #ifdef __cplusplus
@@ -272,15 +272,27 @@ __attribute__((weak)) void send_joystick(report_joystick_t *report) {}
 
 #ifdef DIGITIZER_ENABLE
 void host_digitizer_send(digitizer_t *digitizer) {
+    digitizer_sample_t sample = {
+        .in_range = digitizer->in_range,
+        .tip      = digitizer->tip,
+        .barrel   = digitizer->barrel,
+        .x        = (uint16_t)(digitizer->x * DIGITIZER_POSITION_MAX),
+        .y        = (uint16_t)(digitizer->y * DIGITIZER_POSITION_MAX),
+    };
+
+    host_digitizer_send_sample(&sample);
+}
+
+void host_digitizer_send_sample(const digitizer_sample_t *sample) {
     report_digitizer_t report = {
 #    ifdef DIGITIZER_SHARED_EP
         .report_id = REPORT_ID_DIGITIZER,
 #    endif
-        .in_range = digitizer->in_range,
-        .tip      = digitizer->tip,
-        .barrel   = digitizer->barrel,
-        .x        = (uint16_t)(digitizer->x * 0x7FFF),
-        .y        = (uint16_t)(digitizer->y * 0x7FFF),
+        .in_range = sample->in_range,
+        .tip      = sample->tip,
+        .barrel   = sample->barrel,
+        .x        = sample->x,
+        .y        = sample->y,
     };
 
     send_digitizer(&report);